@@ -6,7 +6,7 @@
  *   - Hardware TRNG using ESP32's built-in RNG peripheral
  *   - WiFi AP mode with configurable SSID/password
  *   - Beautiful WebUI with tarot card spreads
- *   - REST API for drawing cards
+ *   - Asynchronous REST API for drawing cards (many clients in flight)
  *   - Serial protocol for drawing cards
  *   - OTA firmware update via file upload
  *
@@ -14,23 +14,27 @@
  */
 
 struct DrawResult;
+struct DrawReply;
+struct EntropyChannel;
+struct JsonOut;
+struct BenchContext;
+struct SerialCommand;
+struct MetricsSnapshot;
+enum MetricRoute : uint8_t;
+enum RandomFormat : uint8_t;
 
 #include <WiFi.h>
-#include <WebServer.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
 #include <Update.h>
 #include <Preferences.h>
 #include <esp_random.h>
+#include <esp_rom_crc.h>
+#include <esp_timer.h>
+#include <atomic>
+#include <memory>
 
 // ---- Tarot card data (78 cards) ----
-struct TarotCard {
-  uint8_t id;
-  const char* name;
-  const char* nameEn;
-  const char* arcana; // "major" or "minor"
-  const char* meaningOfUpright;
-  const char* meaningOfReversed;
-};
-
 #include "tarot_data.h"
 
 // ---- Configuration ----
@@ -38,126 +42,593 @@ Preferences prefs;
 String apSSID = "CIBYP-IoT-TRNG";
 String apPassword = "";
 
-WebServer server(80);
+AsyncWebServer server(80);
+uint32_t restartAtMs = 0;  // deferred ESP.restart() so the HTTP reply can go out first
+int serialCore = -1;       // core running loop() and the serial protocol
+
+// ---- Entropy Core ----
+// Health tests, entropy channels, the unbiased sampler and card draws; kept free
+// of FreeRTOS/WiFi so IoT-Firmware/native can build and benchmark them on a host
+#include "entropy_core.h"
+
+// ---- Entropy Channels ----
+// A low-priority FreeRTOS producer task harvests hardware RNG words during idle
+// time into one single-producer/single-consumer ring per consumer context:
+// httpChannel feeds the HTTP handlers (async_tcp task), serialChannel feeds the
+// serial protocol (loop). Each ring has exactly one reader, so neither side
+// needs a lock, and each channel carries its own bit reservoir and counters.
+//
+// On dual-core chips (S3) the producer is pinned next to loop() on the Arduino
+// core, leaving the other core to WiFi/lwIP and the HTTP handlers. Single-core
+// chips (C3/C6) run the same tasks unpinned.
+#define POOL_WORDS_INTERNAL 1024     // per channel: 4 KB in internal RAM
+#define POOL_WORDS_PSRAM    32768    // per channel: 128 KB on PSRAM-equipped boards
+#define POOL_TASK_STACK     2048
+
+#if CONFIG_FREERTOS_UNICORE
+#define ENTROPY_CORE tskNO_AFFINITY
+#else
+#define ENTROPY_CORE ARDUINO_RUNNING_CORE
+#endif
+
+EntropyChannel httpChannel;
+EntropyChannel serialChannel;
+bool poolInPSRAM = false;
+volatile uint32_t poolRefillRate = 0;  // words/s harvested over the last second
+
+// One ChaCha20 DRBG per channel, keyed and reseeded from that channel (drbg.h).
+// Bulk consumers opt in per request (/api/random?mode=drbg, RANDOM:<n>,drbg);
+// everything else keeps drawing straight from the channel.
+#include "drbg.h"
 
-// ---- TRNG Core ----
-uint32_t trngRead32() {
-  return esp_random(); // Hardware RNG on all ESP32 variants
+typedef DrbgSource<EntropyChannel> ChannelDrbg;
+ChannelDrbg httpDrbg(httpChannel);
+ChannelDrbg serialDrbg(serialChannel);
+
+// Start-up / recovery test: HEALTH_STARTUP_SAMPLES consecutive passing samples,
+// restarted whenever any test (including a consumer's fallback path) trips
+void runStartupTest() {
+  uint32_t trips = healthTrips.load(std::memory_order_acquire);
+  uint32_t passed = 0;
+  while (passed < HEALTH_STARTUP_SAMPLES) {
+    if (!producerHealth.word(esp_random()) || healthTrips.load(std::memory_order_acquire) != trips) {
+      trips = healthTrips.load(std::memory_order_acquire);
+      passed = 0;
+      vTaskDelay(1);
+      continue;
+    }
+    passed += 4;
+  }
+  healthState.store(HEALTH_OK, std::memory_order_release);
 }
 
-uint8_t trngReadByte() {
-  return (uint8_t)(esp_random() & 0xFF);
+void poolProducerTask(void*) {
+  uint32_t windowStart = millis();
+  uint32_t windowWords = 0;
+  for (;;) {
+    if (healthState.load(std::memory_order_acquire) != HEALTH_OK) runStartupTest();
+    uint32_t n = refillChannel(httpChannel) + refillChannel(serialChannel);
+    if (n == 0) vTaskDelay(1);
+    windowWords += n;
+    uint32_t now = millis();
+    if (now - windowStart >= 1000) {
+      poolRefillRate = (uint32_t)((uint64_t)windowWords * 1000 / (now - windowStart));
+      windowWords = 0;
+      windowStart = now;
+    }
+  }
 }
 
-// Unbiased random in range [0, range) using rejection sampling
-uint32_t trngUnbiased(uint32_t range) {
-  if (range <= 1) return 0;
-  uint32_t maxVal = (0xFFFFFFFF / range) * range;
-  uint32_t val;
-  do {
-    val = trngRead32();
-  } while (val >= maxVal);
-  return val % range;
+bool allocChannel(EntropyChannel& ch, bool psram) {
+  uint32_t words = psram ? POOL_WORDS_PSRAM : POOL_WORDS_INTERNAL;
+  ch.buf = (uint32_t*)(psram ? ps_malloc(words * 4) : malloc(words * 4));
+  ch.capacity = ch.buf ? words : 0;
+  return ch.buf != nullptr;
 }
 
-// ---- Draw a single card ----
-struct DrawResult {
-  uint8_t cardIndex;
-  bool isReversed;
-};
+void poolBegin() {
+  poolInPSRAM = psramFound() && allocChannel(httpChannel, true) && allocChannel(serialChannel, true);
+  if (!poolInPSRAM) {
+    free(httpChannel.buf);
+    free(serialChannel.buf);
+    if (!allocChannel(httpChannel, false) || !allocChannel(serialChannel, false)) {
+      Serial.println("Entropy pool allocation failed, reading RNG directly");
+    }
+  }
+  // Idle priority: the producer only runs when nothing else wants the CPU
+  xTaskCreatePinnedToCore(poolProducerTask, "entropyPool", POOL_TASK_STACK, nullptr, tskIDLE_PRIORITY, nullptr, ENTROPY_CORE);
+  Serial.printf("Entropy pool: 2 x %u words (%s), %d core(s)\n", httpChannel.capacity,
+                poolInPSRAM ? "PSRAM" : "internal", portNUM_PROCESSORS);
+}
+
+// ---- JSON Helpers ----
+#include "draw_json.h"
+#include "draw_cbor.h"
 
-DrawResult drawSingleCard() {
-  DrawResult r;
-  r.cardIndex = (uint8_t)trngUnbiased(78);
-  r.isReversed = trngReadByte() < 128;
-  return r;
+// Spread registry (spreads.h) and its JSON form for /api/spreads and SPREADS,
+// rendered once at boot; the ETag is the CRC-32 of the rendered document.
+#include "spreads.h"
+
+String spreadsJSON;
+char spreadsETag[12];
+
+void spreadsBegin() {
+  spreadsJSON = "{\"spreads\":[";
+  for (int i = 0; i < TAROT_SPREAD_COUNT; i++) {
+    const TarotSpread& sp = tarotSpreads[i];
+    if (i > 0) spreadsJSON += ',';
+    spreadsJSON += "{\"id\":\"" + String(sp.id) + "\",\"count\":" + String(sp.count) +
+                   ",\"name\":\"" + String(sp.name) + "\",\"nameEn\":\"" + String(sp.nameEn) + "\",\"positions\":[";
+    for (int p = 0; p < sp.count; p++) {
+      if (p > 0) spreadsJSON += ',';
+      spreadsJSON += "\"" + String(sp.positions[p]) + "\"";
+    }
+    spreadsJSON += "]}";
+  }
+  spreadsJSON += "]}";
+  uint32_t crc = esp_rom_crc32_le(0, (const uint8_t*)spreadsJSON.c_str(), spreadsJSON.length());
+  snprintf(spreadsETag, sizeof(spreadsETag), "\"%08x\"", crc);
 }
 
-// Draw multiple unique cards
-void drawMultipleCards(DrawResult* results, int count) {
-  if (count > 78) count = 78;
-  bool used[78] = {false};
-  for (int i = 0; i < count; i++) {
-    uint8_t idx;
-    do {
-      idx = (uint8_t)trngUnbiased(78);
-    } while (used[idx]);
-    used[idx] = true;
-    results[i].cardIndex = idx;
-    results[i].isReversed = trngReadByte() < 128;
+// The serial sink writes from a fixed buffer; HTTP responses are generated
+// directly into the TCP send buffer (see sendDrawReply).
+char serialJsonBuf[JSON_BUF_SIZE];
+
+// ---- Metrics ----
+// Latency histograms for every route and serial command (metrics.h), scraped
+// as Prometheus text from /api/metrics or METRICS
+#include "metrics.h"
+
+MetricsRegistry metrics;
+
+// Times a route handler into its histogram. This is the time until the handler
+// has queued its response; bodies filled later by the TCP stack are not counted.
+ArRequestHandlerFunction timed(MetricRoute route, void (*handler)(AsyncWebServerRequest*)) {
+  return [route, handler](AsyncWebServerRequest* request) {
+    uint32_t start = micros();
+    handler(request);
+    metrics.routes[route].record(micros() - start);
+  };
+}
+
+// ---- Serial Session ----
+// A command may carry a request id: "#<id> <CMD>" (id is a decimal u32). The id is
+// echoed as the first field of the JSON reply, so a host can keep the port open,
+// pipeline several commands and match each reply to its caller. HELLO answers
+// with the protocol version; the host uses it to resync past any boot log.
+// Replies are collected in serialTxBuf and written once per input line (or
+// whenever the buffer fills), so a ';' batch is answered in a single write.
+#define SERIAL_PROTO_VERSION 3
+#define SERIAL_RX_BUFFER_SIZE 1024
+#define SERIAL_TX_BUFFER_SIZE 4096
+
+bool serialReplyHasId = false;
+uint32_t serialReplyId = 0;
+uint8_t serialTxBuf[SERIAL_TX_BUFFER_SIZE];
+size_t serialTxLen = 0;
+
+void serialFlush() {
+  if (serialTxLen == 0) return;
+  Serial.write(serialTxBuf, serialTxLen);
+  serialTxLen = 0;
+}
+
+void serialOut(const void* data, size_t len) {
+  const uint8_t* p = (const uint8_t*)data;
+  while (len > 0) {
+    if (serialTxLen == SERIAL_TX_BUFFER_SIZE) serialFlush();
+    size_t n = SERIAL_TX_BUFFER_SIZE - serialTxLen;
+    if (n > len) n = len;
+    memcpy(serialTxBuf + serialTxLen, p, n);
+    serialTxLen += n;
+    p += n;
+    len -= n;
   }
 }
 
-// ---- JSON Helpers ----
-String cardToJSON(const DrawResult& r) {
-  const TarotCard& c = tarotCards[r.cardIndex];
-  String json = "{";
-  json += "\"cardIndex\":" + String(r.cardIndex) + ",";
-  json += "\"name\":\"" + String(c.name) + "\",";
-  json += "\"nameEn\":\"" + String(c.nameEn) + "\",";
-  json += "\"arcana\":\"" + String(c.arcana) + "\",";
-  json += "\"isReversed\":" + String(r.isReversed ? "true" : "false") + ",";
-  json += "\"orientation\":\"" + String(r.isReversed ? "reversed" : "upright") + "\",";
-  json += "\"meaningOfUpright\":\"" + String(c.meaningOfUpright) + "\",";
-  json += "\"meaningOfReversed\":\"" + String(c.meaningOfReversed) + "\"";
-  json += "}";
-  return json;
+void serialOut(char c) {
+  serialOut(&c, 1);
 }
 
-String drawResultsToJSON(DrawResult* results, int count, const char* spreadName) {
-  String json = "{\"spread\":\"" + String(spreadName) + "\",\"cards\":[";
-  for (int i = 0; i < count; i++) {
-    if (i > 0) json += ",";
-    json += cardToJSON(results[i]);
+// Write the start of a reply line, injecting "id" when the current command carried one
+void serialReplyBegin(const char* json, size_t len) {
+  if (serialReplyHasId && len > 0 && json[0] == '{') {
+    char head[20];
+    serialOut(head, snprintf(head, sizeof(head), "{\"id\":%u", serialReplyId));
+    if (len > 2) serialOut(',');
+    serialOut(json + 1, len - 1);
+  } else {
+    serialOut(json, len);
   }
-  json += "],\"entropySource\":\"TRNG\",\"device\":\"ESP32\"}";
-  return json;
+}
+
+void serialReply(const char* json, size_t len) {
+  serialReplyBegin(json, len);
+  serialOut('\n');
+}
+
+void serialReplyf(const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(serialJsonBuf, JSON_BUF_SIZE, fmt, args);
+  va_end(args);
+  if (n < 0) return;
+  serialReply(serialJsonBuf, n < JSON_BUF_SIZE ? n : JSON_BUF_SIZE - 1);
+}
+
+void printJSON(const JsonOut& out) {
+  serialReply(out.buf, out.len);
+}
+
+// After FMT:CBOR, draw, spread, RANDOM and SEED replies go out as CBOR frames
+// (draw_cbor.h): the byte SERIAL_CBOR_FRAME, the payload length as a
+// little-endian u16, then the payload with the request id inside the map.
+// 0xC0 never occurs in UTF-8, so a host tells frames from JSON lines by their
+// first byte. Errors and every other reply stay JSON; HELLO resets to JSON.
+#define SERIAL_CBOR_FRAME 0xC0
+
+bool serialCbor = false;
+
+void printCBOR(const JsonOut& out) {
+  uint8_t head[3] = { SERIAL_CBOR_FRAME, (uint8_t)out.len, (uint8_t)(out.len >> 8) };
+  serialOut(head, sizeof(head));
+  serialOut(out.buf, out.len);
+}
+
+// Draws of up to 78 cards outgrow serialJsonBuf: the rest of the reply is
+// regenerated window by window, the same way HTTP responses are filled.
+// A full-deck CBOR draw is under 200 bytes and goes out in one piece.
+void printDrawReply(const DrawReply& reply) {
+  JsonOut out(serialJsonBuf, JSON_BUF_SIZE);
+  if (serialCbor) {
+    drawReplyToCBOR(out, reply, serialReplyHasId, serialReplyId);
+    printCBOR(out);
+    return;
+  }
+  reply.toJSON(out);
+  serialReplyBegin(out.buf, out.len);
+  for (size_t sent = out.len; sent < out.pos;) {
+    JsonOut next(serialJsonBuf, JSON_BUF_SIZE, sent);
+    reply.toJSON(next);
+    serialOut(next.buf, next.len);
+    sent += next.len;
+  }
+  serialOut('\n');
 }
 
 // ---- Web UI HTML ----
 #include "web_ui.h"
+#include "web_ui_gz.h"
 
 // ---- API Endpoints ----
-void handleRoot() {
-  server.send(200, "text/html", getWebUIHTML());
+// All handlers run in the async_tcp task; several connections can be in flight
+// at once and a slow client only holds its own socket.
+
+// The page is served straight from flash, gzip-compressed when the client
+// accepts it, with a strong ETag so repeat visits revalidate to a 304.
+void handleRoot(AsyncWebServerRequest* request) {
+  bool gzip = request->hasHeader("Accept-Encoding") && request->header("Accept-Encoding").indexOf("gzip") >= 0;
+  const char* etag = gzip ? WEB_UI_ETAG_GZIP : WEB_UI_ETAG;
+  AsyncWebServerResponse* response;
+  if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == etag) {
+    response = request->beginResponse(304);
+  } else if (gzip) {
+    response = request->beginResponse(200, "text/html", WEB_UI_GZ, WEB_UI_GZ_LEN);
+    response->addHeader("Content-Encoding", "gzip");
+  } else {
+    response = request->beginResponse(200, "text/html", (const uint8_t*)WEB_UI_HTML, sizeof(WEB_UI_HTML) - 1);
+  }
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", "no-cache");
+  response->addHeader("Vary", "Accept-Encoding");
+  request->send(response);
 }
 
-void handleAPIDraw() {
-  DrawResult r = drawSingleCard();
-  server.send(200, "application/json", cardToJSON(r));
+// A drawn result travels with its response; the filler re-serializes whichever
+// window of the JSON the TCP stack asks for, straight into its send buffer.
+#define HEALTH_ERROR_JSON "{\"ok\":false,\"error\":\"RNG health test failed\"}"
+
+void sendHealthError(AsyncWebServerRequest* request) {
+  request->send(503, "application/json", HEALTH_ERROR_JSON);
 }
 
-void handleAPISpread() {
-  String spreadType = server.hasArg("type") ? server.arg("type") : "single";
-  int count = 1;
-  const char* spreadName = "single";
-  
-  if (spreadType == "three") { count = 3; spreadName = "三张牌阵"; }
-  else if (spreadType == "celtic") { count = 10; spreadName = "凯尔特十字"; }
-  else if (spreadType == "horseshoe") { count = 7; spreadName = "马蹄牌阵"; }
-  else if (spreadType == "star") { count = 5; spreadName = "五芒星牌阵"; }
-  else if (spreadType == "hexagram") { count = 7; spreadName = "六芒星牌阵"; }
-  else if (spreadType == "zodiac") { count = 12; spreadName = "黄道十二宫"; }
-  else if (spreadType == "yes_no") { count = 1; spreadName = "是非牌"; }
-  else if (spreadType == "relationship") { count = 5; spreadName = "关系牌阵"; }
-  else { count = 1; spreadName = "单牌"; }
-
-  DrawResult results[12];
-  drawMultipleCards(results, count);
-  server.send(200, "application/json", drawResultsToJSON(results, count, spreadName));
-}
-
-void handleAPIRandom() {
-  // Return raw TRNG bytes as JSON
-  uint32_t val = trngRead32();
-  String json = "{\"value\":" + String(val) + ",\"hex\":\"0x" + String(val, HEX) + "\",\"entropySource\":\"TRNG\"}";
-  server.send(200, "application/json", json);
-}
-
-void handleAPIConfig() {
-  if (server.method() == HTTP_POST) {
-    String newSSID = server.hasArg("ssid") ? server.arg("ssid") : "";
-    String newPass = server.hasArg("password") ? server.arg("password") : "";
+// Compact replies (draw_cbor.h) on "?format=cbor" or "Accept: application/cbor";
+// an explicit format= wins over the Accept header
+bool wantsCBOR(AsyncWebServerRequest* request) {
+  if (request->hasArg("format")) return request->arg("format") == "cbor";
+  return request->hasHeader("Accept") && request->header("Accept").indexOf("application/cbor") >= 0;
+}
+
+void sendDrawReply(AsyncWebServerRequest* request, const DrawReply& reply) {
+  bool cbor = wantsCBOR(request);
+  JsonOut sizing(nullptr, 0);
+  if (cbor) drawReplyToCBOR(sizing, reply);
+  else reply.toJSON(sizing);
+  AsyncWebServerResponse* response = request->beginResponse(cbor ? "application/cbor" : "application/json", sizing.pos,
+    [reply, cbor](uint8_t* buf, size_t maxLen, size_t index) -> size_t {
+      JsonOut out((char*)buf, maxLen, index);
+      if (cbor) drawReplyToCBOR(out, reply);
+      else reply.toJSON(out);
+      return out.len;
+    });
+  response->addHeader("Vary", "Accept");
+  request->send(response);
+}
+
+// GET /api/draw: one card; ?count=N draws N unique cards in one response (400
+// unless 1-78)
+void handleAPIDraw(AsyncWebServerRequest* request) {
+  if (!entropyReady(httpChannel)) return sendHealthError(request);
+  DrawReply reply;
+  if (request->hasArg("count")) {
+    long count = request->arg("count").toInt();
+    if (!drawCountValid(count)) {
+      request->send(400, "application/json", "{\"ok\":false,\"error\":\"count must be 1-78\"}");
+      return;
+    }
+    drawReplyFor(httpChannel, reply, (int)count, nullptr);
+  } else {
+    reply.count = 1;
+    reply.single = true;
+    reply.spreadName = nullptr;
+    reply.cards[0] = drawSingleCard(httpChannel);
+  }
+  if (!entropyHealthy(httpChannel)) return sendHealthError(request);
+  sendDrawReply(request, reply);
+}
+
+void handleAPISpread(AsyncWebServerRequest* request) {
+  String spreadType = request->hasArg("type") ? request->arg("type") : "single";
+  const TarotSpread& spread = findSpread(spreadType.c_str());
+  if (!entropyReady(httpChannel)) return sendHealthError(request);
+  DrawReply reply;
+  drawReplyFor(httpChannel, reply, spread.count, spread.name, spread.id);
+  if (!entropyHealthy(httpChannel)) return sendHealthError(request);
+  sendDrawReply(request, reply);
+}
+
+// Spread metadata changes only with the firmware, so clients revalidate with
+// If-None-Match and normally get a bodiless 304.
+void handleAPISpreads(AsyncWebServerRequest* request) {
+  AsyncWebServerResponse* response;
+  if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == spreadsETag) {
+    response = request->beginResponse(304);
+  } else {
+    response = request->beginResponse(200, "application/json", (const uint8_t*)spreadsJSON.c_str(), spreadsJSON.length());
+  }
+  response->addHeader("ETag", spreadsETag);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+
+// ---- Bulk entropy streaming ----
+// /api/random?bytes=N streams N bytes in fixed chunks straight from the RNG,
+// so the full response never sits in heap.
+#define RANDOM_CHUNK_SIZE 1024
+#define RANDOM_MAX_BYTES (16UL * 1024 * 1024)
+
+uint32_t randomLastBps = 0;      // throughput of the most recent bulk request (bytes/s)
+uint32_t randomPeakBps = 0;      // best throughput seen since boot (bytes/s)
+StatCounter64 randomBytesServed;  // total bulk bytes sent since boot
+
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+void httpFill(bool drbg, uint8_t* buf, size_t len) {
+  if (drbg) trngFill(httpDrbg, buf, len);
+  else trngFill(httpChannel, buf, len);
+}
+
+enum RandomFormat : uint8_t { RANDOM_RAW, RANDOM_HEX, RANDOM_CBOR };
+
+// Each call fills at most one chunk of the TCP send buffer with fresh bytes.
+// RANDOM_CBOR is the raw stream behind a CBOR byte-string head.
+void streamRandomBytes(AsyncWebServerRequest* request, size_t count, RandomFormat format, bool drbg) {
+  bool hex = format == RANDOM_HEX;
+  uint8_t head[5];
+  size_t headLen = 0;
+  if (format == RANDOM_CBOR) {
+    JsonOut h((char*)head, sizeof(head));
+    cborHead(h, CBOR_BYTES, (uint32_t)count);
+    headLen = h.len;
+  }
+  size_t total = (hex ? count * 2 : count) + headLen;
+  uint32_t start = micros();
+  const char* type = hex ? "text/plain" : format == RANDOM_CBOR ? "application/cbor" : "application/octet-stream";
+  AsyncWebServerResponse* response = request->beginResponse(type, total,
+    [count, total, hex, drbg, start, head, headLen](uint8_t* buf, size_t maxLen, size_t index) -> size_t {
+      // Fail closed mid-transfer: hold the response while the source re-tests
+      if (!entropyReady(httpChannel)) return RESPONSE_TRY_AGAIN;
+      if (index < headLen) {
+        size_t n = headLen - index;
+        if (n > maxLen) n = maxLen;
+        memcpy(buf, head + index, n);
+        return n;
+      }
+      size_t len = total - index;
+      if (len > maxLen) len = maxLen;
+      if (len > RANDOM_CHUNK_SIZE * (hex ? 2 : 1)) len = RANDOM_CHUNK_SIZE * (hex ? 2 : 1);
+      if (hex) {
+        size_t n = len / 2;
+        if (n == 0) return RESPONSE_TRY_AGAIN;
+        // Random bytes go in the upper half and expand forward into hex in place
+        httpFill(drbg, buf + n, n);
+        for (size_t i = 0; i < n; i++) {
+          uint8_t b = buf[n + i];
+          buf[i * 2] = HEX_DIGITS[b >> 4];
+          buf[i * 2 + 1] = HEX_DIGITS[b & 0x0F];
+        }
+        len = n * 2;
+      } else {
+        httpFill(drbg, buf, len);
+      }
+      if (!entropyHealthy(httpChannel)) return RESPONSE_TRY_AGAIN;
+      if (index + len == total) {
+        uint32_t elapsed = micros() - start;
+        randomBytesServed += count;
+        if (elapsed > 0 && count >= RANDOM_CHUNK_SIZE) {
+          randomLastBps = (uint32_t)((uint64_t)count * 1000000ULL / elapsed);
+          if (randomLastBps > randomPeakBps) randomPeakBps = randomLastBps;
+        }
+      }
+      return len;
+    });
+  response->addHeader("X-Entropy-Source", drbg ? ENTROPY_SOURCE_DRBG : "TRNG");
+  request->send(response);
+}
+
+// ?mode=trng (default) reads the channel; ?mode=drbg reads its DRBG
+void handleAPIRandom(AsyncWebServerRequest* request) {
+  String mode = request->hasArg("mode") ? request->arg("mode") : "trng";
+  if (mode != "trng" && mode != "drbg") {
+    request->send(400, "application/json", "{\"ok\":false,\"error\":\"mode must be trng or drbg\"}");
+    return;
+  }
+  bool drbg = mode == "drbg";
+  if (request->hasArg("bytes")) {
+    long count = request->arg("bytes").toInt();
+    if (count <= 0 || count > (long)RANDOM_MAX_BYTES) {
+      request->send(400, "application/json", "{\"ok\":false,\"error\":\"bytes must be 1-16777216\"}");
+      return;
+    }
+    RandomFormat format = wantsCBOR(request) ? RANDOM_CBOR
+                        : request->hasArg("format") && request->arg("format") == "hex" ? RANDOM_HEX : RANDOM_RAW;
+    if (!entropyReady(httpChannel)) return sendHealthError(request);
+    streamRandomBytes(request, (size_t)count, format, drbg);
+    return;
+  }
+
+  // Return one random word as JSON (or CBOR)
+  if (!entropyReady(httpChannel)) return sendHealthError(request);
+  uint32_t val = drbg ? trngRead32(httpDrbg) : trngRead32(httpChannel);
+  if (!entropyHealthy(httpChannel)) return sendHealthError(request);
+  if (wantsCBOR(request)) {
+    char buf[32];
+    JsonOut out(buf, sizeof(buf));
+    randomValueToCBOR(out, val, drbg ? ENTROPY_SOURCE_DRBG : "TRNG");
+    AsyncResponseStream* response = request->beginResponseStream("application/cbor");
+    response->write((const uint8_t*)out.buf, out.len);
+    response->addHeader("Vary", "Accept");
+    request->send(response);
+    return;
+  }
+  String json = "{\"value\":" + String(val) + ",\"hex\":\"0x" + String(val, HEX) +
+                "\",\"entropySource\":\"" + String(drbg ? ENTROPY_SOURCE_DRBG : "TRNG") + "\"}";
+  request->send(200, "application/json", json);
+}
+
+// GET /api/seed: full-width PRNG seeds, ?bits=32-256 (multiple of 32, default
+// 64) and ?count=N with bits/8*count <= 1024; ?mode=drbg as for /api/random.
+// The whole batch comes from one fill and is served like a draw reply.
+void handleAPISeed(AsyncWebServerRequest* request) {
+  String mode = request->hasArg("mode") ? request->arg("mode") : "trng";
+  long bits = request->hasArg("bits") ? request->arg("bits").toInt() : SEED_DEFAULT_BITS;
+  long count = request->hasArg("count") ? request->arg("count").toInt() : 1;
+  if ((mode != "trng" && mode != "drbg") || !seedRequestValid(bits, count)) {
+    request->send(400, "application/json",
+                  "{\"ok\":false,\"error\":\"bits must be 32-256 in steps of 32, bits/8*count at most 1024, mode trng or drbg\"}");
+    return;
+  }
+  bool drbg = mode == "drbg";
+  if (!entropyReady(httpChannel)) return sendHealthError(request);
+  auto reply = std::make_shared<SeedReply>();
+  if (drbg) seedReplyFor(httpDrbg, *reply, bits, count, ENTROPY_SOURCE_DRBG);
+  else seedReplyFor(httpChannel, *reply, bits, count, "TRNG");
+  if (!entropyHealthy(httpChannel)) return sendHealthError(request);
+  bool cbor = wantsCBOR(request);
+  JsonOut sizing(nullptr, 0);
+  if (cbor) seedReplyToCBOR(sizing, *reply);
+  else reply->toJSON(sizing);
+  AsyncWebServerResponse* response = request->beginResponse(cbor ? "application/cbor" : "application/json", sizing.pos,
+    [reply, cbor](uint8_t* buf, size_t maxLen, size_t index) -> size_t {
+      JsonOut out((char*)buf, maxLen, index);
+      if (cbor) seedReplyToCBOR(out, *reply);
+      else reply->toJSON(out);
+      return out.len;
+    });
+  response->addHeader("Vary", "Accept");
+  request->send(response);
+}
+
+// ---- Push stream ----
+// GET /api/stream keeps one chunked text/event-stream response open per client
+// and feeds it from event_stream.h. Parameters:
+//   kind=random|draw (default random)   rate=1-100 events/s (default 10)
+//   bytes=1-1024 per random event (default 32)
+//   cards=1-78 or type=<spread> per draw event   events=N ends after N events
+//   mode=trng|drbg as for /api/random
+// The filler only runs when the TCP send buffer has room, so a slow reader
+// throttles its own stream; each client costs about 1.3 KB of heap.
+#include "event_stream.h"
+
+#define STREAM_MAX_CLIENTS 4
+
+std::atomic<uint8_t> streamClients{0};
+StatCounter streamEventsSent;
+
+struct HttpEventStream : EntropyEventStream {
+  using EntropyEventStream::EntropyEventStream;
+  ~HttpEventStream() { streamClients.fetch_sub(1); }
+};
+
+void sendStreamError(AsyncWebServerRequest* request, const char* error) {
+  request->send(400, "application/json", String("{\"ok\":false,\"error\":\"") + error + "\"}");
+}
+
+long streamArg(AsyncWebServerRequest* request, const char* name, long fallback) {
+  return request->hasArg(name) ? request->arg(name).toInt() : fallback;
+}
+
+void handleAPIStream(AsyncWebServerRequest* request) {
+  String kind = request->hasArg("kind") ? request->arg("kind") : "random";
+  String mode = request->hasArg("mode") ? request->arg("mode") : "trng";
+  long rate = streamArg(request, "rate", 10);
+  long bytes = streamArg(request, "bytes", 32);
+  long cards = streamArg(request, "cards", 1);
+  long events = streamArg(request, "events", 0);
+  if (kind != "random" && kind != "draw") return sendStreamError(request, "kind must be random or draw");
+  if (mode != "trng" && mode != "drbg") return sendStreamError(request, "mode must be trng or drbg");
+  if (rate < 1 || rate > EVENT_STREAM_MAX_RATE) return sendStreamError(request, "rate must be 1-100");
+  if (bytes < 1 || bytes > EVENT_STREAM_MAX_BLOCK) return sendStreamError(request, "bytes must be 1-1024");
+  if (cards < 1 || cards > TAROT_CARD_COUNT) return sendStreamError(request, "cards must be 1-78");
+  if (events < 0) return sendStreamError(request, "events must be >= 0");
+  if (!entropyReady(httpChannel)) return sendHealthError(request);
+
+  if (streamClients.fetch_add(1) >= STREAM_MAX_CLIENTS) {
+    streamClients.fetch_sub(1);
+    request->send(503, "application/json", "{\"ok\":false,\"error\":\"Too many streams\"}");
+    return;
+  }
+  bool drbg = mode == "drbg";
+  auto stream = std::make_shared<HttpEventStream>(httpChannel, drbg ? &httpDrbg : nullptr);
+  stream->kind = kind == "draw" ? EntropyEventStream::DRAW : EntropyEventStream::RANDOM;
+  stream->blockBytes = (uint16_t)bytes;
+  stream->drawCount = (int)cards;
+  if (request->hasArg("type")) {
+    const TarotSpread& spread = findSpread(request->arg("type").c_str());
+    stream->drawCount = spread.count;
+    stream->spreadName = spread.name;
+    stream->spreadId = spread.id;
+  }
+  stream->intervalMs = 1000 / rate;
+  stream->limited = events > 0;
+  stream->remaining = (uint32_t)events;
+
+  AsyncWebServerResponse* response = request->beginChunkedResponse("text/event-stream",
+    [stream](uint8_t* buf, size_t maxLen, size_t) -> size_t {
+      uint32_t seq = stream->seq;
+      size_t n = stream->fill(buf, maxLen, millis());
+      streamEventsSent += stream->seq - seq;
+      return n == EVENT_STREAM_WAIT ? RESPONSE_TRY_AGAIN : n;
+    });
+  response->addHeader("Cache-Control", "no-cache");
+  response->addHeader("X-Entropy-Source", drbg ? ENTROPY_SOURCE_DRBG : "TRNG");
+  request->send(response);
+}
+
+void handleAPIConfig(AsyncWebServerRequest* request) {
+  if (request->method() == HTTP_POST) {
+    String newSSID = request->hasArg("ssid") ? request->arg("ssid") : "";
+    String newPass = request->hasArg("password") ? request->arg("password") : "";
     if (newSSID.length() > 0) {
       apSSID = newSSID;
       apPassword = newPass;
@@ -165,98 +636,707 @@ void handleAPIConfig() {
       prefs.putString("ssid", apSSID);
       prefs.putString("pass", apPassword);
       prefs.end();
-      server.send(200, "application/json", "{\"ok\":true,\"message\":\"AP config saved. Restarting...\"}");
-      delay(1000);
-      ESP.restart();
+      request->send(200, "application/json", "{\"ok\":true,\"message\":\"AP config saved. Restarting...\"}");
+      restartAtMs = millis() + 1000;
     } else {
-      server.send(400, "application/json", "{\"ok\":false,\"error\":\"SSID cannot be empty\"}");
+      request->send(400, "application/json", "{\"ok\":false,\"error\":\"SSID cannot be empty\"}");
     }
   } else {
     String json = "{\"ssid\":\"" + apSSID + "\",\"hasPassword\":" + String(apPassword.length() > 0 ? "true" : "false") + "}";
-    server.send(200, "application/json", json);
+    request->send(200, "application/json", json);
   }
 }
 
-void handleOTAUpload() {
-  HTTPUpload& upload = server.upload();
-  if (upload.status == UPLOAD_FILE_START) {
-    Serial.printf("OTA Update: %s\n", upload.filename.c_str());
+void handleOTAUpload(AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t* data, size_t len, bool final) {
+  if (index == 0) {
+    Serial.printf("OTA Update: %s\n", filename.c_str());
     if (!Update.begin(UPDATE_SIZE_UNKNOWN)) {
       Update.printError(Serial);
     }
-  } else if (upload.status == UPLOAD_FILE_WRITE) {
-    if (Update.write(upload.buf, upload.currentSize) != upload.currentSize) {
-      Update.printError(Serial);
-    }
-  } else if (upload.status == UPLOAD_FILE_END) {
+  }
+  if (len > 0 && Update.write(data, len) != len) {
+    Update.printError(Serial);
+  }
+  if (final) {
     if (Update.end(true)) {
-      Serial.printf("OTA Update Success: %u bytes\n", upload.totalSize);
+      Serial.printf("OTA Update Success: %u bytes\n", index + len);
     } else {
       Update.printError(Serial);
     }
   }
 }
 
-void handleOTAResult() {
+void handleOTAResult(AsyncWebServerRequest* request) {
   if (Update.hasError()) {
-    server.send(500, "application/json", "{\"ok\":false,\"error\":\"OTA update failed\"}");
+    request->send(500, "application/json", "{\"ok\":false,\"error\":\"OTA update failed\"}");
   } else {
-    server.send(200, "application/json", "{\"ok\":true,\"message\":\"OTA update success. Restarting...\"}");
-    delay(1000);
-    ESP.restart();
+    request->send(200, "application/json", "{\"ok\":true,\"message\":\"OTA update success. Restarting...\"}");
+    restartAtMs = millis() + 1000;
   }
 }
 
-void handleAPIInfo() {
+String channelStatsJSON(const EntropyChannel& ch) {
+  return "{\"capacity\":" + String(ch.capacity) + ",\"level\":" + String(ch.level()) +
+         ",\"underruns\":" + String(ch.underruns.load()) + "}";
+}
+
+void handleAPIInfo(AsyncWebServerRequest* request) {
   String json = "{";
   json += "\"device\":\"ESP32\",";
   json += "\"firmware\":\"CIBYP-TRNG v1.0.0\",";
   json += "\"freeHeap\":" + String(ESP.getFreeHeap()) + ",";
+  json += "\"minFreeHeap\":" + String(ESP.getMinFreeHeap()) + ",";
+  json += "\"maxAllocHeap\":" + String(ESP.getMaxAllocHeap()) + ",";
   json += "\"chipModel\":\"" + String(ESP.getChipModel()) + "\",";
   json += "\"chipRevision\":" + String(ESP.getChipRevision()) + ",";
   json += "\"cpuFreqMHz\":" + String(ESP.getCpuFreqMHz()) + ",";
   json += "\"flashSize\":" + String(ESP.getFlashChipSize()) + ",";
+  json += "\"randomThroughputBps\":" + String(randomLastBps) + ",";
+  json += "\"randomPeakBps\":" + String(randomPeakBps) + ",";
+  json += "\"randomBytesServed\":" + String(randomBytesServed.load()) + ",";
+  uint32_t words = httpChannel.wordsConsumed + serialChannel.wordsConsumed;
+  uint32_t cards = httpChannel.cardsDrawn + serialChannel.cardsDrawn;
+  uint32_t drawWords = httpChannel.drawWords + serialChannel.drawWords;
+  json += "\"rng\":{\"wordsConsumed\":" + String(words) + ",\"cardsDrawn\":" + String(cards) +
+          ",\"wordsPerCard\":" + String(cards ? (float)drawWords / cards : 0.0f, 3) + "},";
+  json += "\"pool\":{\"refillWordsPerSec\":" + String(poolRefillRate) +
+          ",\"psram\":" + String(poolInPSRAM ? "true" : "false") +
+          ",\"http\":" + channelStatsJSON(httpChannel) + ",\"serial\":" + channelStatsJSON(serialChannel) + "},";
+  json += "\"drbg\":{\"algorithm\":\"ChaCha20\",\"reseedIntervalBytes\":" + String(httpDrbg.reseedInterval) +
+          ",\"reseeds\":" + String(httpDrbg.reseeds.load() + serialDrbg.reseeds.load()) +
+          ",\"bytesGenerated\":" + String(httpDrbg.bytesGenerated.load() + serialDrbg.bytesGenerated.load()) + "},";
+  json += "\"stream\":{\"clients\":" + String(streamClients.load()) + ",\"maxClients\":" + String(STREAM_MAX_CLIENTS) +
+          ",\"eventsSent\":" + String(streamEventsSent.load()) + "},";
+  json += "\"cores\":{\"count\":" + String(portNUM_PROCESSORS) + ",\"http\":" + String(xPortGetCoreID()) +
+          ",\"serial\":" + String(serialCore) + "},";
   json += "\"ssid\":\"" + apSSID + "\",";
   json += "\"ip\":\"" + WiFi.softAPIP().toString() + "\"";
   json += "}";
-  server.send(200, "application/json", json);
+  request->send(200, "application/json", json);
+}
+
+// Health test status, shared by /api/health and HEALTH; failure counts cover the
+// producer and both channels' fallback reads
+String healthJSON() {
+  const HealthTest* tests[] = { &producerHealth, &httpChannel.fallback.health, &serialChannel.fallback.health };
+  uint32_t rct = 0, apt = 0;
+  for (const HealthTest* t : tests) {
+    rct += t->rctFailures;
+    apt += t->aptFailures;
+  }
+  bool ok = healthState.load(std::memory_order_acquire) == HEALTH_OK;
+  return "{\"state\":\"" + String(healthStateName()) + "\",\"healthy\":" + String(ok ? "true" : "false") +
+         ",\"trips\":" + String(healthTrips.load(std::memory_order_relaxed)) +
+         ",\"sampleBits\":8,\"minEntropyPerSample\":7,\"falsePositiveRate\":\"2^-40\"" +
+         ",\"rct\":{\"cutoff\":" + String(HEALTH_RCT_CUTOFF) + ",\"failures\":" + String(rct) + "}" +
+         ",\"apt\":{\"window\":" + String(HEALTH_APT_WINDOW) + ",\"cutoff\":" + String(HEALTH_APT_CUTOFF) +
+         ",\"failures\":" + String(apt) + "}}";
+}
+
+void handleAPIHealth(AsyncWebServerRequest* request) {
+  bool ok = healthState.load(std::memory_order_acquire) == HEALTH_OK;
+  request->send(ok ? 200 : 503, "application/json", healthJSON());
+}
+
+// Copies every metric at once; a scrape renders only from the copy
+void captureMetrics(MetricsSnapshot& m) {
+  m.captureHistograms(metrics);
+  m.channels[0] = channelCounters("http", httpChannel, httpDrbg);
+  m.channels[1] = channelCounters("serial", serialChannel, serialDrbg);
+  m.uptimeSeconds = millis() / 1000;
+  m.healthTrips = healthTrips.load(std::memory_order_relaxed);
+  m.healthy = healthState.load(std::memory_order_acquire) == HEALTH_OK;
+  m.poolRefillWordsPerSec = poolRefillRate;
+  m.randomBytesServed = randomBytesServed;
+  m.streamClients = streamClients.load();
+  m.streamEventsSent = streamEventsSent;
+  m.heapFree = ESP.getFreeHeap();
+  m.heapMinFree = ESP.getMinFreeHeap();
+  m.heapMaxAlloc = ESP.getMaxAllocHeap();
+}
+
+// GET /api/metrics: Prometheus text, about 35 KB, regenerated window by window
+// from one snapshot like a draw reply
+void handleAPIMetrics(AsyncWebServerRequest* request) {
+  auto snapshot = std::make_shared<MetricsSnapshot>();
+  captureMetrics(*snapshot);
+  JsonOut sizing(nullptr, 0);
+  snapshot->toPrometheus(sizing);
+  request->send(request->beginResponse("text/plain; version=0.0.4", sizing.pos,
+    [snapshot](uint8_t* buf, size_t maxLen, size_t index) -> size_t {
+      JsonOut out((char*)buf, maxLen, index);
+      snapshot->toPrometheus(out);
+      return out.len;
+    }));
+}
+
+void handleNotFound(AsyncWebServerRequest* request) {
+  request->send(404, "application/json", "{\"ok\":false,\"error\":\"Not found\"}");
+}
+
+// ---- Benchmark & Self-Test ----
+// Timed loops over the entropy and serialization hot paths plus a chi-square
+// test of single-card draws over all 156 card/orientation cells. Runs on the
+// caller's channel, so it measures the real serving path (pool hits and
+// underruns included) and its draws count towards the channel statistics.
+// A run advances in time-bounded slices, so on the HTTP task other requests are
+// served between slices however long the whole run takes on a slow chip.
+#define BENCH_DEFAULT_ITERATIONS 10000
+#define BENCH_MAX_ITERATIONS     100000
+#define BENCH_DEFAULT_DRAWS      15600   // 100 expected per cell
+#define BENCH_MAX_DRAWS          156000
+#define BENCH_SPREAD_CARDS       10
+#define BENCH_FILL_BYTES         1024
+#define BENCH_BATCH              1000    // ops timed between clock reads (/10 for spread-sized ops)
+// A slice ends at the first batch past BENCH_SLICE_US. Over HTTP the next slice
+// starts when the client ACKs the previous slice's progress byte: one round trip
+// on the soft-AP (a few ms), but a client's delayed-ACK timer can stretch it to
+// ~40 ms (Linux/macOS) or ~200 ms (Windows). Wall time is therefore roughly
+// 1.1x the measured time, 2x with a Linux client and up to 5x with a Windows one.
+// The serial BENCH runs its slices back to back.
+#define BENCH_SLICE_US           50000
+
+volatile uint32_t benchSink;  // keeps results observable so loops are not elided
+
+struct BenchContext {
+  EntropyChannel* ch;
+  ChannelDrbg* drbg;
+  JsonOut* out;
+  DrawResult cards[BENCH_SPREAD_CARDS];
+};
+
+void benchRead32(BenchContext& c, uint32_t n) {
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < n; i++) acc ^= trngRead32(*c.ch);
+  benchSink = acc;
+}
+
+// Bulk fills reuse the JSON buffer as their destination
+void benchFill(BenchContext& c, uint32_t n) {
+  for (uint32_t i = 0; i < n; i++) trngFill(*c.ch, (uint8_t*)c.out->buf, BENCH_FILL_BYTES);
+  benchSink = c.out->buf[0];
+}
+
+void benchDrbgFill(BenchContext& c, uint32_t n) {
+  for (uint32_t i = 0; i < n; i++) trngFill(*c.drbg, (uint8_t*)c.out->buf, BENCH_FILL_BYTES);
+  benchSink = c.out->buf[0];
+}
+
+void benchUnbiased78(BenchContext& c, uint32_t n) {
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < n; i++) acc += trngUnbiased(*c.ch, 78);
+  benchSink = acc;
+}
+
+void benchDrawSpread(BenchContext& c, uint32_t n) {
+  for (uint32_t i = 0; i < n; i++) drawMultipleCards(*c.ch, c.cards, BENCH_SPREAD_CARDS);
+  benchSink = c.cards[0].cardIndex;
+}
+
+void benchCardJSON(BenchContext& c, uint32_t n) {
+  for (uint32_t i = 0; i < n; i++) {
+    c.out->len = c.out->pos = 0;
+    cardToJSON(*c.out, c.cards[i % BENCH_SPREAD_CARDS]);
+  }
+  benchSink = c.out->len;
+}
+
+void benchSpreadJSON(BenchContext& c, uint32_t n) {
+  for (uint32_t i = 0; i < n; i++) {
+    c.out->len = c.out->pos = 0;
+    drawResultsToJSON(*c.out, c.cards, BENCH_SPREAD_CARDS, "bench");
+  }
+  benchSink = c.out->len;
+}
+
+struct BenchOp {
+  const char* name;
+  uint32_t divisor;  // runs iterations / divisor times
+  void (*fn)(BenchContext&, uint32_t);
+};
+
+const BenchOp BENCH_OPS[] = {
+  {"trngRead32", 1, benchRead32},
+  {"trngFill1K", BENCH_SPREAD_CARDS, benchFill},
+  {"drbgFill1K", BENCH_SPREAD_CARDS, benchDrbgFill},
+  {"trngUnbiased78", 1, benchUnbiased78},
+  {"drawMultipleCards10", BENCH_SPREAD_CARDS, benchDrawSpread},
+  {"cardToJSON", 1, benchCardJSON},
+  {"spreadToJSON10", BENCH_SPREAD_CARDS, benchSpreadJSON},
+};
+constexpr size_t BENCH_OP_COUNT = sizeof(BENCH_OPS) / sizeof(BENCH_OPS[0]);
+
+// Upper-tail p-value of a chi-square statistic (Wilson-Hilferty approximation)
+float chiSquarePValue(float chi2, int df) {
+  float k = 2.0f / (9.0f * df);
+  float z = (powf(chi2 / df, 1.0f / 3.0f) - (1.0f - k)) / sqrtf(k);
+  return 0.5f * erfcf(z / sqrtf(2.0f));
+}
+
+// Each op accumulates its cycles and time over the batches it ran, so the
+// gaps between slices are not counted
+struct BenchRun {
+  BenchContext ctx;
+  const char* channelName;
+  uint32_t iterations;
+  uint32_t draws;
+  char* buf;
+  uint32_t underruns = 0;
+  size_t op = 0;
+  uint32_t opDone = 0;
+  uint32_t opCycles = 0;
+  int64_t opUs = 0;
+  uint32_t drawsDone = 0;
+  uint32_t counts[TAROT_CARD_COUNT * 2] = {};
+  JsonOut out;
+  String json;
+  bool finished = false;
+
+  BenchRun(EntropyChannel& ch, ChannelDrbg& drbg, const char* name, uint32_t iters, uint32_t drawCount)
+      : ctx{ &ch, &drbg, &out, {} }, channelName(name), iterations(iters), draws(drawCount),
+        buf((char*)malloc(JSON_BUF_SIZE)), out(buf, buf ? JSON_BUF_SIZE : 0) {
+    if (iterations < 1) iterations = BENCH_DEFAULT_ITERATIONS;
+    if (iterations > BENCH_MAX_ITERATIONS) iterations = BENCH_MAX_ITERATIONS;
+    if (draws < 156) draws = BENCH_DEFAULT_DRAWS;
+    if (draws > BENCH_MAX_DRAWS) draws = BENCH_MAX_DRAWS;
+  }
+  ~BenchRun() { free(buf); }
+
+  // Runs until the slice budget is spent; true once `json` holds the result
+  bool step(uint32_t sliceUs) {
+    if (finished) return true;
+    if (!buf) {
+      json = "{\"ok\":false,\"error\":\"Out of memory\"}";
+      return finished = true;
+    }
+    EntropyChannel& ch = *ctx.ch;
+    if (op == 0 && opDone == 0 && json.length() == 0) {
+      drawMultipleCards(ch, ctx.cards, BENCH_SPREAD_CARDS);
+      underruns = ch.underruns;
+      json = "{\"chip\":\"" + String(ESP.getChipModel()) + "\",\"cpuFreqMHz\":" + String(ESP.getCpuFreqMHz()) +
+             ",\"firmware\":\"CIBYP-TRNG v1.0.0\",\"channel\":\"" + String(channelName) + "\",\"ops\":{";
+    }
+    int64_t sliceStart = esp_timer_get_time();
+    while (op < BENCH_OP_COUNT) {
+      const BenchOp& o = BENCH_OPS[op];
+      uint32_t n = iterations / o.divisor;
+      uint32_t batch = n - opDone < BENCH_BATCH / o.divisor ? n - opDone : BENCH_BATCH / o.divisor;
+      uint32_t c0 = ESP.getCycleCount();
+      int64_t t0 = esp_timer_get_time();
+      o.fn(ctx, batch);
+      opCycles += ESP.getCycleCount() - c0;
+      opUs += esp_timer_get_time() - t0;
+      opDone += batch;
+      if (opDone >= n) {
+        // "name":{"ops":..,"opsPerSec":..,"cyclesPerOp":..}
+        if (json[json.length() - 1] != '{') json += ',';
+        json += "\"" + String(o.name) + "\":{\"ops\":" + String(n) +
+                ",\"opsPerSec\":" + String(opUs > 0 ? (uint32_t)((uint64_t)n * 1000000ULL / opUs) : 0) +
+                ",\"cyclesPerOp\":" + String(n ? (float)opCycles / n : 0.0f, 1) + "}";
+        op++;
+        opDone = opCycles = 0;
+        opUs = 0;
+        if (op == BENCH_OP_COUNT) json += "},\"underruns\":" + String(ch.underruns - underruns);
+      }
+      if (esp_timer_get_time() - sliceStart >= sliceUs) return false;
+    }
+
+    while (drawsDone < draws) {
+      uint32_t batch = draws - drawsDone < BENCH_BATCH ? draws - drawsDone : BENCH_BATCH;
+      for (uint32_t i = 0; i < batch; i++) {
+        DrawResult r = drawSingleCard(ch);
+        counts[r.cardIndex * 2 + r.isReversed]++;
+      }
+      drawsDone += batch;
+      if (drawsDone < draws && esp_timer_get_time() - sliceStart >= sliceUs) return false;
+    }
+    const int cells = TAROT_CARD_COUNT * 2;
+    float expected = (float)draws / cells;
+    float chi2 = 0;
+    for (int i = 0; i < cells; i++) {
+      float d = counts[i] - expected;
+      chi2 += d * d / expected;
+    }
+    float p = chiSquarePValue(chi2, cells - 1);
+    json += ",\"chiSquare\":{\"draws\":" + String(draws) + ",\"cells\":" + String(cells) +
+            ",\"df\":" + String(cells - 1) + ",\"statistic\":" + String(chi2, 2) +
+            ",\"pValue\":" + String(p, 4) + ",\"pass\":" + String(p > 0.001f ? "true" : "false") + "}";
+    json += ",\"health\":\"" + String(healthStateName()) + "\"}";
+    return finished = true;
+  }
+};
+
+// One HTTP run at a time bounds the heap it holds
+std::atomic<bool> benchBusy{false};
+
+struct HttpBenchRun : BenchRun {
+  using BenchRun::BenchRun;
+  ~HttpBenchRun() { benchBusy.store(false); }
+  size_t padding = 0;  // progress bytes sent ahead of the JSON
+};
+
+// GET /api/bench[?iterations=N&draws=M]
+// The response body is produced by the slices themselves: each filler call
+// runs one. Until the result is ready it sends one byte of leading JSON
+// whitespace, so the client's ACK calls the filler again immediately; without
+// it, RESPONSE_TRY_AGAIN only comes back at the next ~500 ms AsyncTCP poll and
+// the bench would sit idle about 90% of the time.
+void handleAPIBench(AsyncWebServerRequest* request) {
+  uint32_t iterations = request->hasArg("iterations") ? request->arg("iterations").toInt() : 0;
+  uint32_t draws = request->hasArg("draws") ? request->arg("draws").toInt() : 0;
+  if (benchBusy.exchange(true)) {
+    request->send(503, "application/json", "{\"ok\":false,\"error\":\"Benchmark already running\"}");
+    return;
+  }
+  auto run = std::make_shared<HttpBenchRun>(httpChannel, httpDrbg, "http", iterations, draws);
+  AsyncWebServerResponse* response = request->beginChunkedResponse("application/json",
+    [run](uint8_t* buf, size_t maxLen, size_t index) -> size_t {
+      if (maxLen == 0) return RESPONSE_TRY_AGAIN;
+      if (!run->step(BENCH_SLICE_US)) {
+        buf[0] = ' ';
+        run->padding++;
+        return 1;
+      }
+      size_t offset = index - run->padding;
+      size_t n = run->json.length() - offset;
+      if (n > maxLen) n = maxLen;
+      memcpy(buf, run->json.c_str() + offset, n);
+      return n;
+    });
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+
+// ---- Serial binary stream mode ----
+// STREAM switches the serial link to framed binary output until STREAM_STOP_BYTE
+// is received. Frame layout (little-endian):
+//   A5 5A | seq u32 | len u16 | payload[len] | crc32 u32 (over seq..payload)
+#define STREAM_BLOCK_SIZE 256
+#define STREAM_HEADER_SIZE 8
+#define STREAM_FRAME_SIZE (STREAM_HEADER_SIZE + STREAM_BLOCK_SIZE + 4)
+#define STREAM_FRAMES_PER_LOOP 8
+#define STREAM_STOP_BYTE 0x03
+
+bool serialStreaming = false;
+uint32_t streamSeq = 0;
+
+// Returns false, without sending, if a health test tripped while filling
+bool sendStreamFrame() {
+  static uint8_t frame[STREAM_FRAME_SIZE];
+  frame[0] = 0xA5;
+  frame[1] = 0x5A;
+  frame[2] = (uint8_t)(streamSeq);
+  frame[3] = (uint8_t)(streamSeq >> 8);
+  frame[4] = (uint8_t)(streamSeq >> 16);
+  frame[5] = (uint8_t)(streamSeq >> 24);
+  frame[6] = (uint8_t)(STREAM_BLOCK_SIZE & 0xFF);
+  frame[7] = (uint8_t)(STREAM_BLOCK_SIZE >> 8);
+  trngFill(serialChannel, frame + STREAM_HEADER_SIZE, STREAM_BLOCK_SIZE);
+  if (!entropyHealthy(serialChannel)) return false;
+  uint32_t crc = esp_rom_crc32_le(0, frame + 2, STREAM_HEADER_SIZE - 2 + STREAM_BLOCK_SIZE);
+  uint8_t* tail = frame + STREAM_HEADER_SIZE + STREAM_BLOCK_SIZE;
+  tail[0] = (uint8_t)(crc);
+  tail[1] = (uint8_t)(crc >> 8);
+  tail[2] = (uint8_t)(crc >> 16);
+  tail[3] = (uint8_t)(crc >> 24);
+  Serial.write(frame, STREAM_FRAME_SIZE);
+  streamSeq++;
+  return true;
+}
+
+void startSerialStream() {
+  serialReplyf("{\"stream\":true,\"block\":%u,\"frame\":%u,\"stop\":%u}",
+               STREAM_BLOCK_SIZE, STREAM_FRAME_SIZE, STREAM_STOP_BYTE);
+  serialFlush();
+  Serial.flush();
+  streamSeq = 0;
+  serialStreaming = true;
+}
+
+// Called from loop() while streaming: watch for the stop byte, then push a burst of frames
+void serviceSerialStream() {
+  while (Serial.available()) {
+    if (Serial.read() == STREAM_STOP_BYTE) {
+      serialStreaming = false;
+      serialOut('\n');
+      serialReplyf("{\"stream\":false,\"blocks\":%u}", streamSeq);
+      serialFlush();
+      return;
+    }
+  }
+  for (int i = 0; i < STREAM_FRAMES_PER_LOOP; i++) {
+    if (!sendStreamFrame()) {
+      serialStreaming = false;
+      serialOut('\n');
+      serialReplyf("{\"stream\":false,\"blocks\":%u,\"error\":\"RNG health test failed\"}", streamSeq);
+      serialFlush();
+      return;
+    }
+  }
 }
 
 // ---- Serial Protocol ----
-void handleSerialCommand(String cmd) {
-  cmd.trim();
-  if (cmd == "DRAW") {
-    DrawResult r = drawSingleCard();
-    Serial.println(cardToJSON(r));
-  } else if (cmd.startsWith("SPREAD:")) {
-    String type = cmd.substring(7);
-    type.trim();
-    int count = 1;
-    const char* name = "single";
-    if (type == "three") { count = 3; name = "三张牌阵"; }
-    else if (type == "celtic") { count = 10; name = "凯尔特十字"; }
-    else if (type == "horseshoe") { count = 7; name = "马蹄牌阵"; }
-    else if (type == "star") { count = 5; name = "五芒星牌阵"; }
-    else if (type == "hexagram") { count = 7; name = "六芒星牌阵"; }
-    else if (type == "zodiac") { count = 12; name = "黄道十二宫"; }
-    DrawResult results[12];
-    drawMultipleCards(results, count);
-    Serial.println(drawResultsToJSON(results, count, name));
-  } else if (cmd == "RANDOM") {
-    uint32_t val = trngRead32();
-    Serial.printf("{\"value\":%u,\"hex\":\"0x%08x\",\"entropySource\":\"TRNG\"}\n", val, val);
-  } else if (cmd == "INFO") {
-    Serial.printf("{\"device\":\"ESP32\",\"chip\":\"%s\",\"heap\":%u}\n", ESP.getChipModel(), ESP.getFreeHeap());
-  } else if (cmd == "PING") {
-    Serial.println("{\"pong\":true}");
+#include "serial_command.h"
+
+// ---- Serial Link ----
+// With USB CDC on boot (native USB on S3/C3/C6) Serial is a USB endpoint: the
+// line rate the host sets is ignored and transfers run at USB speed, so BAUD
+// only reports the link. On a UART bridge BAUD:<n> is acknowledge-then-switch:
+// the reply goes out at the old rate, the UART is retuned once it has drained,
+// and the host must confirm with PING or HELLO at the new rate within
+// SERIAL_BAUD_CONFIRM_MS or the UART drops back to the previous rate.
+// A confirmed rate outlives the host session that set it, and a bridge that
+// does not reset the board leaves the next host talking at the power-on rate:
+// after SERIAL_BAUD_IDLE_MS without input, or on a break or framing error,
+// the UART returns to SERIAL_BAUD_RATES[0].
+#if ARDUINO_USB_CDC_ON_BOOT
+#define SERIAL_LINK "usb-cdc"
+#else
+#define SERIAL_LINK "uart"
+#endif
+#define SERIAL_BAUD_CONFIRM_MS 1500
+#define SERIAL_BAUD_IDLE_MS    60000   // longer than the host's idle close
+
+uint32_t serialBaud = SERIAL_BAUD_RATES[0];
+uint32_t serialBaudPending = 0;    // switch acknowledged on the current line
+uint32_t serialBaudFallback = 0;   // non-zero until the new rate is confirmed
+uint32_t serialBaudDeadline = 0;
+uint32_t serialLastRxMs = 0;
+std::atomic<bool> serialLineError{false};  // set from the UART event task
+
+bool serialLinkIsUsb() {
+  return strcmp(SERIAL_LINK, "usb-cdc") == 0;
+}
+
+void serialApplyBaud(uint32_t baud) {
+#if !ARDUINO_USB_CDC_ON_BOOT
+  Serial.flush();
+  Serial.updateBaudRate(baud);
+#endif
+  serialBaud = baud;
+}
+
+// Runs after the line's replies have been flushed, so the acknowledgement
+// always leaves at the rate the host sent BAUD at
+void serialApplyPendingBaud() {
+  if (!serialBaudPending) return;
+  serialBaudFallback = serialBaud;
+  serialApplyBaud(serialBaudPending);
+  serialBaudPending = 0;
+  serialBaudDeadline = millis() + SERIAL_BAUD_CONFIRM_MS;
+}
+
+void serialConfirmBaud() {
+  serialBaudFallback = 0;
+}
+
+// Fail-closed guards for drawing commands; both print the error reply themselves
+bool serialEntropyReady() {
+  if (entropyReady(serialChannel)) return true;
+  serialReplyf("{\"error\":\"RNG health test failed\"}");
+  return false;
+}
+
+bool serialEntropyHealthy() {
+  if (entropyHealthy(serialChannel)) return true;
+  serialReplyf("{\"error\":\"RNG health test failed\"}");
+  return false;
+}
+
+// METRICS: the /api/metrics text through serialJsonBuf window by window, then
+// "# EOF". No line starts with '{', so session hosts skip it like boot output.
+void printMetrics() {
+  static MetricsSnapshot snapshot;
+  captureMetrics(snapshot);
+  for (size_t sent = 0;;) {
+    JsonOut out(serialJsonBuf, JSON_BUF_SIZE, sent);
+    snapshot.toPrometheus(out);
+    serialOut(out.buf, out.len);
+    sent += out.len;
+    if (sent >= out.pos) break;
+  }
+  serialOut("# EOF\n", 6);
+}
+
+void runSerialCommand(SerialCommand& cmd) {
+  if (cmd.is("HELLO")) {
+    serialConfirmBaud();
+    serialCbor = false;
+    serialReplyf("{\"hello\":true,\"proto\":%d,\"device\":\"ESP32\",\"chip\":\"%s\",\"firmware\":\"CIBYP-TRNG v1.0.0\",\"link\":\"%s\",\"baud\":%u,\"maxBaud\":%u}",
+                 SERIAL_PROTO_VERSION, ESP.getChipModel(), SERIAL_LINK, serialBaud,
+                 serialLinkIsUsb() ? serialBaud : SERIAL_BAUD_RATES[SERIAL_BAUD_RATE_COUNT - 1]);
+  } else if (cmd.isWithArg("BAUD")) {
+    uint32_t baud = strtoul(cmd.arg, nullptr, 10);
+    if (!serialBaudSupported(baud)) {
+      serialReplyf("{\"error\":\"Unsupported baud rate\"}");
+      return;
+    }
+    if (serialLinkIsUsb()) {
+      serialReplyf("{\"baud\":%u,\"link\":\"%s\",\"confirmMs\":0}", serialBaud, SERIAL_LINK);
+      return;
+    }
+    serialBaudPending = baud;
+    serialReplyf("{\"baud\":%u,\"link\":\"%s\",\"confirmMs\":%u}", baud, SERIAL_LINK, SERIAL_BAUD_CONFIRM_MS);
+  } else if (cmd.isWithArg("FMT")) {
+    if (strcmp(cmd.arg, "CBOR") == 0 || strcmp(cmd.arg, "JSON") == 0) {
+      serialCbor = cmd.arg[0] == 'C';
+      serialReplyf("{\"format\":\"%s\"}", serialCbor ? "cbor" : "json");
+    } else {
+      serialReplyf("{\"error\":\"FMT:<CBOR|JSON>\"}");
+    }
+  } else if (cmd.is("DRAW")) {
+    if (!serialEntropyReady()) return;
+    DrawReply reply;
+    reply.count = 1;
+    reply.single = true;
+    reply.spreadName = nullptr;
+    reply.cards[0] = drawSingleCard(serialChannel);
+    if (!serialEntropyHealthy()) return;
+    printDrawReply(reply);
+  } else if (cmd.isWithArg("DRAW")) {
+    long count = atol(cmd.arg);
+    if (!drawCountValid(count)) {
+      serialReplyf("{\"error\":\"DRAW:<n> requires 1-%d\"}", TAROT_CARD_COUNT);
+      return;
+    }
+    if (!serialEntropyReady()) return;
+    DrawReply reply;
+    drawReplyFor(serialChannel, reply, (int)count, nullptr);
+    if (!serialEntropyHealthy()) return;
+    printDrawReply(reply);
+  } else if (cmd.isWithArg("SPREAD")) {
+    const TarotSpread& spread = findSpread(cmd.arg);
+    if (!serialEntropyReady()) return;
+    DrawReply reply;
+    drawReplyFor(serialChannel, reply, spread.count, spread.name, spread.id);
+    if (!serialEntropyHealthy()) return;
+    printDrawReply(reply);
+  } else if (cmd.is("SPREADS")) {
+    serialReply(spreadsJSON.c_str(), spreadsJSON.length());
+  } else if (cmd.is("RANDOM")) {
+    if (!serialEntropyReady()) return;
+    uint32_t val = trngRead32(serialChannel);
+    if (!serialEntropyHealthy()) return;
+    if (serialCbor) {
+      JsonOut out(serialJsonBuf, JSON_BUF_SIZE);
+      randomValueToCBOR(out, val, "TRNG", serialReplyHasId, serialReplyId);
+      printCBOR(out);
+      return;
+    }
+    serialReplyf("{\"value\":%u,\"hex\":\"0x%08x\",\"entropySource\":\"TRNG\"}", val, val);
+  } else if (cmd.isWithArg("RANDOM")) {
+    // RANDOM:<n>[,drbg]: bulk bytes as hex in one JSON line, for host-side
+    // prefetch buffers; ",drbg" reads the channel's DRBG instead
+    char* modeArg = splitAt(cmd.arg, ',');
+    const char* mode = modeArg ? modeArg : "trng";
+    long count = atol(cmd.arg);
+    if (count < 1 || count > RANDOM_CHUNK_SIZE || (strcmp(mode, "trng") != 0 && strcmp(mode, "drbg") != 0)) {
+      serialReplyf("{\"error\":\"RANDOM:<n>[,drbg] requires 1-%u\"}", RANDOM_CHUNK_SIZE);
+      return;
+    }
+    bool drbg = strcmp(mode, "drbg") == 0;
+    if (!serialEntropyReady()) return;
+    static uint8_t raw[RANDOM_CHUNK_SIZE];
+    if (drbg) trngFill(serialDrbg, raw, count);
+    else trngFill(serialChannel, raw, count);
+    if (!serialEntropyHealthy()) return;
+    JsonOut out(serialJsonBuf, JSON_BUF_SIZE);
+    if (serialCbor) {
+      randomBytesToCBOR(out, raw, count, drbg ? ENTROPY_SOURCE_DRBG : "TRNG", serialReplyHasId, serialReplyId);
+      printCBOR(out);
+      return;
+    }
+    out.write("{\"bytes\":\"");
+    for (long i = 0; i < count; i++) {
+      out.write(HEX_DIGITS[raw[i] >> 4]);
+      out.write(HEX_DIGITS[raw[i] & 0x0F]);
+    }
+    out.write("\",\"entropySource\":\"");
+    out.write(drbg ? ENTROPY_SOURCE_DRBG : "TRNG");
+    out.write("\"}");
+    printJSON(out);
+  } else if (cmd.named("SEED")) {
+    // SEED[:<bits>[,<count>[,drbg]]]: full-width PRNG seeds, same limits as /api/seed
+    long bits = SEED_DEFAULT_BITS, count = 1;
+    const char* mode = "trng";
+    if (cmd.hasArg()) {
+      char* countArg = splitAt(cmd.arg, ',');
+      char* modeArg = countArg ? splitAt(countArg, ',') : nullptr;
+      bits = atol(cmd.arg);
+      if (countArg) count = atol(countArg);
+      if (modeArg) mode = modeArg;
+    }
+    if (!seedRequestValid(bits, count) || (strcmp(mode, "trng") != 0 && strcmp(mode, "drbg") != 0)) {
+      serialReplyf("{\"error\":\"SEED:<bits>[,<count>[,drbg]] requires bits 32-256 in steps of 32, bits/8*count <= %u\"}",
+                   SEED_MAX_BYTES);
+      return;
+    }
+    bool drbg = strcmp(mode, "drbg") == 0;
+    if (!serialEntropyReady()) return;
+    static SeedReply reply;
+    if (drbg) seedReplyFor(serialDrbg, reply, bits, count, ENTROPY_SOURCE_DRBG);
+    else seedReplyFor(serialChannel, reply, bits, count, "TRNG");
+    if (!serialEntropyHealthy()) return;
+    JsonOut out(serialJsonBuf, JSON_BUF_SIZE);
+    if (serialCbor) {
+      seedReplyToCBOR(out, reply, serialReplyHasId, serialReplyId);
+      printCBOR(out);
+      return;
+    }
+    reply.toJSON(out);
+    printJSON(out);
+  } else if (cmd.is("INFO")) {
+    serialReplyf("{\"device\":\"ESP32\",\"chip\":\"%s\",\"heap\":%u,\"minHeap\":%u,\"maxAlloc\":%u,\"poolLevel\":%u,\"poolCapacity\":%u,\"poolRefillWordsPerSec\":%u,\"poolUnderruns\":%u,\"core\":%d}",
+                 ESP.getChipModel(), ESP.getFreeHeap(), ESP.getMinFreeHeap(), ESP.getMaxAllocHeap(), serialChannel.level(),
+                 serialChannel.capacity, poolRefillRate, serialChannel.underruns.load(), xPortGetCoreID());
+  } else if (cmd.named("BENCH")) {
+    // BENCH[:<iterations>[,<draws>]]
+    uint32_t iterations = 0, draws = 0;
+    if (cmd.hasArg()) {
+      char* drawsArg = splitAt(cmd.arg, ',');
+      iterations = atol(cmd.arg);
+      if (drawsArg) draws = atol(drawsArg);
+    }
+    BenchRun run(serialChannel, serialDrbg, "serial", iterations, draws);
+    while (!run.step(BENCH_SLICE_US)) {}
+    serialReply(run.json.c_str(), run.json.length());
+  } else if (cmd.is("HEALTH")) {
+    String json = healthJSON();
+    serialReply(json.c_str(), json.length());
+  } else if (cmd.is("STREAM")) {
+    if (!serialEntropyReady()) return;
+    startSerialStream();
+  } else if (cmd.is("PING")) {
+    serialConfirmBaud();
+    serialReplyf("{\"pong\":true}");
+  } else if (cmd.is("METRICS")) {
+    printMetrics();
   } else {
-    Serial.println("{\"error\":\"Unknown command\"}");
+    serialReplyf("{\"error\":\"Unknown command\"}");
   }
 }
 
+// One command of a line; tokenized in place, so `seg` is modified. Each one
+// is timed into the histogram of its command word.
+void handleSerialCommand(char* seg) {
+  uint32_t start = micros();
+  SerialCommand cmd = parseSerialCommand(seg);
+  serialReplyHasId = cmd.hasId;
+  serialReplyId = cmd.id;
+  if (cmd.valid) runSerialCommand(cmd);
+  else serialReplyf("{\"error\":\"Bad request id\"}");
+  metrics.serial[metricSerialFor(cmd.name)].record(micros() - start);
+}
+
 // ---- Setup & Loop ----
 void setup() {
-  Serial.begin(115200);
+  Serial.setRxBufferSize(SERIAL_RX_BUFFER_SIZE);
+  Serial.begin(SERIAL_BAUD_RATES[0]);
+#if !ARDUINO_USB_CDC_ON_BOOT
+  Serial.onReceiveError([](hardwareSerial_error_t err) {
+    if (err == UART_BREAK_ERROR || err == UART_FRAME_ERROR) serialLineError.store(true, std::memory_order_relaxed);
+  });
+#endif
   Serial.println("\n=== CIBYP-IoT-TRNG v1.0.0 ===");
 
   // Load config
@@ -265,6 +1345,10 @@ void setup() {
   apPassword = prefs.getString("pass", "");
   prefs.end();
 
+  serialCore = xPortGetCoreID();
+  poolBegin();
+  spreadsBegin();
+
   // Start AP
   WiFi.mode(WIFI_AP);
   if (apPassword.length() > 0) {
@@ -276,34 +1360,88 @@ void setup() {
   Serial.print("AP IP: "); Serial.println(WiFi.softAPIP());
 
   // Setup web server
-  server.on("/", handleRoot);
-  server.on("/api/draw", handleAPIDraw);
-  server.on("/api/spread", handleAPISpread);
-  server.on("/api/random", handleAPIRandom);
-  server.on("/api/config", handleAPIConfig);
-  server.on("/api/info", handleAPIInfo);
-  server.on("/api/ota", HTTP_POST, handleOTAResult, handleOTAUpload);
+  server.on("/", HTTP_GET, timed(METRIC_ROUTE_root, handleRoot));
+  server.on("/api/draw", HTTP_GET, timed(METRIC_ROUTE_draw, handleAPIDraw));
+  server.on("/api/spread", HTTP_GET, timed(METRIC_ROUTE_spread, handleAPISpread));
+  server.on("/api/spreads", HTTP_GET, timed(METRIC_ROUTE_spreads, handleAPISpreads));
+  server.on("/api/random", HTTP_GET, timed(METRIC_ROUTE_random, handleAPIRandom));
+  server.on("/api/seed", HTTP_GET, timed(METRIC_ROUTE_seed, handleAPISeed));
+  server.on("/api/stream", HTTP_GET, timed(METRIC_ROUTE_stream, handleAPIStream));
+  server.on("/api/config", HTTP_GET | HTTP_POST, timed(METRIC_ROUTE_config, handleAPIConfig));
+  server.on("/api/info", HTTP_GET, timed(METRIC_ROUTE_info, handleAPIInfo));
+  server.on("/api/health", HTTP_GET, timed(METRIC_ROUTE_health, handleAPIHealth));
+  server.on("/api/bench", HTTP_GET, timed(METRIC_ROUTE_bench, handleAPIBench));
+  server.on("/api/metrics", HTTP_GET, timed(METRIC_ROUTE_metrics, handleAPIMetrics));
+  server.on("/api/ota", HTTP_POST, timed(METRIC_ROUTE_ota, handleOTAResult), handleOTAUpload);
+  server.onNotFound(timed(METRIC_ROUTE_other, handleNotFound));
 
   server.begin();
   Serial.println("Web server started on port 80");
-  Serial.println("Serial commands: DRAW, SPREAD:<type>, RANDOM, INFO, PING");
+  Serial.println("Serial link: " SERIAL_LINK);
+  Serial.println("Serial commands: HELLO, BAUD:<n>, FMT:<CBOR|JSON>, DRAW[:<n>], SPREAD:<type>, SPREADS, RANDOM[:<n>[,drbg]], SEED[:<bits>[,<count>[,drbg]]], STREAM, INFO, HEALTH, BENCH, METRICS, PING (prefix \"#<id> \" to tag replies, \";\" to batch)");
 }
 
-String serialBuffer = "";
+SerialLineReader serialLine;
+
+// Drops whatever arrived at the old rate along with any half-read line
+void serialRevertBaud(uint32_t baud) {
+  serialApplyBaud(baud);
+  serialBaudFallback = 0;
+  while (Serial.available()) Serial.read();
+  serialLine.reset();
+}
+
+// Only a confirmed rate counts: during the confirm window the deadline above
+// decides, and a retuning bridge may glitch the line
+bool serialBaudStranded() {
+  if (serialLinkIsUsb() || serialBaud == SERIAL_BAUD_RATES[0] || serialBaudFallback) {
+    serialLineError.store(false, std::memory_order_relaxed);
+    return false;
+  }
+  return serialLineError.exchange(false, std::memory_order_relaxed) ||
+         (int32_t)(millis() - serialLastRxMs) >= SERIAL_BAUD_IDLE_MS;
+}
+
+// A line may batch several ';'-separated commands; they run in order and their
+// replies go out together. Commands after one that starts STREAM are dropped;
+// a BAUD switch takes effect once the whole line has been answered.
+void handleSerialLine(char* line, bool overflow) {
+  if (overflow) {
+    serialReplyHasId = false;
+    serialReplyf("{\"error\":\"Line too long (max %u)\"}", SERIAL_LINE_MAX);
+  } else {
+    forEachSerialCommand(line, [](char* seg) {
+      handleSerialCommand(seg);
+      return !serialStreaming;
+    });
+  }
+  serialFlush();
+  serialApplyPendingBaud();
+}
 
 void loop() {
-  server.handleClient();
+  if (restartAtMs && (int32_t)(millis() - restartAtMs) >= 0) ESP.restart();
+
+  if (serialStreaming) {
+    serviceSerialStream();
+    serialLastRxMs = millis();
+    delay(1);
+    return;
+  }
   
+  // Unconfirmed line-rate change: the host never got through, go back
+  if (serialBaudFallback && (int32_t)(millis() - serialBaudDeadline) >= 0) {
+    serialRevertBaud(serialBaudFallback);
+  }
+  // Negotiated rate left behind by a host that has gone away
+  if (serialBaudStranded()) serialRevertBaud(SERIAL_BAUD_RATES[0]);
+
   // Handle serial input
+  if (Serial.available()) serialLastRxMs = millis();
   while (Serial.available()) {
-    char c = Serial.read();
-    if (c == '\n' || c == '\r') {
-      if (serialBuffer.length() > 0) {
-        handleSerialCommand(serialBuffer);
-        serialBuffer = "";
-      }
-    } else {
-      serialBuffer += c;
+    if (serialLine.push((char)Serial.read())) {
+      handleSerialLine(serialLine.line, serialLine.overflow);
+      if (serialStreaming) break;
     }
   }
 
@@ -0,0 +1,41 @@
+/*
+ * Precomputed card JSON for CIBYP-IoT-TRNG
+ * All 78 x 2 card/orientation objects are assembled by the preprocessor from
+ * TAROT_CARD_LIST and stored in flash, so serving a card is a single copy.
+ */
+
+#ifndef CARD_JSON_H
+#define CARD_JSON_H
+
+struct CardFragment {
+  const char* json;
+  uint16_t len;
+};
+
+#define CARD_JSON(id, name, nameEn, arcana, up, rev, isReversed, orientation) \
+  "{\"cardIndex\":" #id ",\"name\":\"" name "\",\"nameEn\":\"" nameEn "\",\"arcana\":\"" arcana \
+  "\",\"isReversed\":" isReversed ",\"orientation\":\"" orientation \
+  "\",\"meaningOfUpright\":\"" up "\",\"meaningOfReversed\":\"" rev "\"}"
+
+#define CARD_FRAGMENT(id, name, nameEn, arcana, up, rev, isReversed, orientation) \
+  { CARD_JSON(id, name, nameEn, arcana, up, rev, isReversed, orientation), \
+    (uint16_t)(sizeof(CARD_JSON(id, name, nameEn, arcana, up, rev, isReversed, orientation)) - 1) },
+
+#define CARD_FRAGMENT_PAIR(id, name, nameEn, arcana, up, rev) \
+  CARD_FRAGMENT(id, name, nameEn, arcana, up, rev, "false", "upright") \
+  CARD_FRAGMENT(id, name, nameEn, arcana, up, rev, "true", "reversed")
+
+// Indexed by cardIndex * 2 + isReversed
+const CardFragment cardFragments[78 * 2] = {
+  TAROT_CARD_LIST(CARD_FRAGMENT_PAIR)
+};
+
+#undef CARD_FRAGMENT_PAIR
+#undef CARD_FRAGMENT
+#undef CARD_JSON
+
+inline const CardFragment& cardFragment(uint8_t cardIndex, bool isReversed) {
+  return cardFragments[cardIndex * 2 + (isReversed ? 1 : 0)];
+}
+
+#endif // CARD_JSON_H
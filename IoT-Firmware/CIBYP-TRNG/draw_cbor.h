@@ -0,0 +1,133 @@
+/*
+ * Compact CBOR replies for CIBYP-IoT-TRNG
+ * Draws, spreads and random values encoded as CBOR (RFC 8949) maps that carry
+ * only what the host cannot look up itself: card codes, the spread id and the
+ * entropy source. Names and meanings stay in the host's copy of the deck, so a
+ * ten-card spread is about 40 bytes instead of several KB of JSON. Output goes
+ * through JsonOut, which is a plain byte sink, so async responses regenerate
+ * CBOR windows exactly like JSON ones.
+ *
+ * Map keys are one-letter text strings:
+ *   "i" request id (serial only)    "s" spread id ("celtic", ...)
+ *   "c" card code, or an array of card codes for multi-card draws
+ *   "v" 32-bit random value         "b" random bytes (byte string)
+ *   "n" seed width in bits          "d" array of seeds (byte strings)
+ *   "e" entropy source ("TRNG", "TRNG-DRBG")
+ * A card code is cardIndex * 2 + isReversed (0-155).
+ */
+
+#ifndef DRAW_CBOR_H
+#define DRAW_CBOR_H
+
+#include "draw_json.h"
+
+enum CborMajor : uint8_t {
+  CBOR_UINT = 0,
+  CBOR_BYTES = 2,
+  CBOR_TEXT = 3,
+  CBOR_ARRAY = 4,
+  CBOR_MAP = 5,
+};
+
+// Item head: major type plus its argument in the shortest encoding
+inline void cborHead(JsonOut& out, CborMajor major, uint32_t v) {
+  char b[5];
+  size_t n;
+  uint8_t m = (uint8_t)(major << 5);
+  if (v < 24) {
+    b[0] = (char)(m | v);
+    n = 1;
+  } else if (v <= 0xFF) {
+    b[0] = (char)(m | 24);
+    b[1] = (char)v;
+    n = 2;
+  } else if (v <= 0xFFFF) {
+    b[0] = (char)(m | 25);
+    b[1] = (char)(v >> 8);
+    b[2] = (char)v;
+    n = 3;
+  } else {
+    b[0] = (char)(m | 26);
+    b[1] = (char)(v >> 24);
+    b[2] = (char)(v >> 16);
+    b[3] = (char)(v >> 8);
+    b[4] = (char)v;
+    n = 5;
+  }
+  out.write(b, n);
+}
+
+inline void cborText(JsonOut& out, const char* s) {
+  size_t n = strlen(s);
+  cborHead(out, CBOR_TEXT, (uint32_t)n);
+  out.write(s, n);
+}
+
+inline uint32_t cardCode(const DrawResult& r) {
+  return (uint32_t)r.cardIndex * 2 + (r.isReversed ? 1 : 0);
+}
+
+inline void cborId(JsonOut& out, bool hasId, uint32_t id) {
+  if (!hasId) return;
+  cborText(out, "i");
+  cborHead(out, CBOR_UINT, id);
+}
+
+// {"i"?, "s"?, "c": code | [codes], "e"}; a single draw carries a bare code
+inline void drawReplyToCBOR(JsonOut& out, const DrawReply& reply, bool hasId = false, uint32_t id = 0) {
+  cborHead(out, CBOR_MAP, 2 + (hasId ? 1 : 0) + (reply.spreadId ? 1 : 0));
+  cborId(out, hasId, id);
+  if (reply.spreadId) {
+    cborText(out, "s");
+    cborText(out, reply.spreadId);
+  }
+  cborText(out, "c");
+  if (reply.single) {
+    cborHead(out, CBOR_UINT, cardCode(reply.cards[0]));
+  } else {
+    cborHead(out, CBOR_ARRAY, (uint32_t)reply.count);
+    for (int i = 0; i < reply.count; i++) cborHead(out, CBOR_UINT, cardCode(reply.cards[i]));
+  }
+  cborText(out, "e");
+  cborText(out, reply.source);
+}
+
+// {"i"?, "v": value, "e": source}
+inline void randomValueToCBOR(JsonOut& out, uint32_t value, const char* source, bool hasId = false, uint32_t id = 0) {
+  cborHead(out, CBOR_MAP, 2 + (hasId ? 1 : 0));
+  cborId(out, hasId, id);
+  cborText(out, "v");
+  cborHead(out, CBOR_UINT, value);
+  cborText(out, "e");
+  cborText(out, source);
+}
+
+// {"i"?, "b": bytes, "e": source}
+inline void randomBytesToCBOR(JsonOut& out, const uint8_t* bytes, size_t len, const char* source,
+                              bool hasId = false, uint32_t id = 0) {
+  cborHead(out, CBOR_MAP, 2 + (hasId ? 1 : 0));
+  cborId(out, hasId, id);
+  cborText(out, "b");
+  cborHead(out, CBOR_BYTES, (uint32_t)len);
+  out.write((const char*)bytes, len);
+  cborText(out, "e");
+  cborText(out, source);
+}
+
+// {"i"?, "n": bits, "d": [seeds], "e": source}
+inline void seedReplyToCBOR(JsonOut& out, const SeedReply& reply, bool hasId = false, uint32_t id = 0) {
+  cborHead(out, CBOR_MAP, 3 + (hasId ? 1 : 0));
+  cborId(out, hasId, id);
+  cborText(out, "n");
+  cborHead(out, CBOR_UINT, reply.bits);
+  cborText(out, "d");
+  cborHead(out, CBOR_ARRAY, reply.count);
+  for (uint16_t i = 0; i < reply.count; i++) {
+    cborHead(out, CBOR_BYTES, (uint32_t)reply.seedBytes());
+    out.write((const char*)reply.raw + i * reply.seedBytes(), reply.seedBytes());
+  }
+  cborText(out, "e");
+  cborText(out, reply.source);
+}
+
+#endif // DRAW_CBOR_H
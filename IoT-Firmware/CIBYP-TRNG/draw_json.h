@@ -0,0 +1,177 @@
+/*
+ * Draw reply serialization for CIBYP-IoT-TRNG
+ * JsonOut (fixed-buffer writer with a skip window), card / draw JSON and the
+ * DrawReply and SeedReply values that async responses re-serialize on demand.
+ * Shared by the HTTP handlers, the serial protocol and the native tests and
+ * benchmarks.
+ */
+
+#ifndef DRAW_JSON_H
+#define DRAW_JSON_H
+
+#include "entropy_core.h"
+#include "tarot_data.h"
+#include "card_json.h"
+
+// Draw responses are serialized into a caller-supplied fixed buffer, so the draw
+// path makes no heap allocations. A 12-card zodiac response is under 3 KB;
+// larger draws are emitted in buffer-sized windows.
+// `skip` drops the first bytes of output, which lets an async response be
+// regenerated window by window; `pos` is the full logical length.
+#define JSON_BUF_SIZE 4096
+
+struct JsonOut {
+  char* buf;
+  size_t cap;
+  size_t skip;
+  size_t len;
+  size_t pos;
+
+  JsonOut(char* b, size_t c, size_t s = 0) : buf(b), cap(c), skip(s), len(0), pos(0) {}
+
+  void write(const char* s, size_t n) {
+    if (pos < skip) {
+      size_t drop = skip - pos;
+      if (drop >= n) {
+        pos += n;
+        return;
+      }
+      s += drop;
+      n -= drop;
+      pos += drop;
+    }
+    size_t copy = n < cap - len ? n : cap - len;
+    if (copy) memcpy(buf + len, s, copy);
+    len += copy;
+    pos += n;
+  }
+  void write(const char* s) { write(s, strlen(s)); }
+  void write(char c) { write(&c, 1); }
+
+  void writeU32(uint32_t v) {
+    char tmp[10];
+    int n = 0;
+    do {
+      tmp[n++] = (char)('0' + v % 10);
+      v /= 10;
+    } while (v);
+    while (n > 0) write(tmp[--n]);
+  }
+};
+
+// Card objects are precomputed at compile time (card_json.h)
+inline void cardToJSON(JsonOut& out, const DrawResult& r) {
+  const CardFragment& f = cardFragment(r.cardIndex, r.isReversed);
+  out.write(f.json, f.len);
+}
+
+// spreadName may be nullptr for a plain multi-card draw (DRAW:N, /api/draw?count=N)
+inline void drawResultsToJSON(JsonOut& out, const DrawResult* results, int count, const char* spreadName,
+                              const char* source = ENTROPY_SOURCE_TRNG) {
+  out.write('{');
+  if (spreadName) {
+    out.write("\"spread\":\"");
+    out.write(spreadName);
+    out.write("\",");
+  }
+  out.write("\"count\":");
+  out.writeU32(count);
+  out.write(",\"cards\":[");
+  for (int i = 0; i < count; i++) {
+    if (i > 0) out.write(',');
+    cardToJSON(out, results[i]);
+  }
+  out.write("],\"entropySource\":\"");
+  out.write(source);
+  out.write("\",\"device\":\"ESP32\"}");
+}
+
+// A finished draw, small enough to copy into an async response callback and
+// re-serialize on demand instead of holding the rendered JSON.
+struct DrawReply {
+  DrawResult cards[78];
+  int count;
+  bool single;             // bare card object (DRAW, /api/draw without count)
+  const char* spreadName;  // nullptr for a plain multi-card draw
+  const char* spreadId = nullptr;  // registry id for compact replies (draw_cbor.h)
+  const char* source = ENTROPY_SOURCE_TRNG;  // entropySource label
+
+  void toJSON(JsonOut& out) const {
+    if (single) cardToJSON(out, cards[0]);
+    else drawResultsToJSON(out, cards, count, spreadName, source);
+  }
+};
+
+// Request check for /api/draw?count=N and DRAW:N; out-of-range counts are
+// rejected by the caller rather than clamped
+inline bool drawCountValid(long count) {
+  return count >= 1 && count <= TAROT_CARD_COUNT;
+}
+
+// Fill a reply for a named spread or a plain unique draw of `count` cards;
+// `source` labels where the cards came from, as in seedReplyFor
+template <class Source>
+void drawReplyFor(Source& src, DrawReply& reply, int count, const char* spreadName, const char* spreadId = nullptr,
+                  const char* source = ENTROPY_SOURCE_TRNG) {
+  if (count < 1) count = 1;
+  if (count > TAROT_CARD_COUNT) count = TAROT_CARD_COUNT;
+  reply.count = count;
+  reply.single = false;
+  reply.spreadName = spreadName;
+  reply.spreadId = spreadId;
+  reply.source = source;
+  drawMultipleCards(src, reply.cards, count);
+}
+
+// Full-width seeds for game PRNGs (/api/seed, SEED): `count` seeds of `bits`
+// bits each, straight from the source, one fill for the whole batch
+#define SEED_DEFAULT_BITS 64
+#define SEED_MAX_BITS 256
+#define SEED_MAX_BYTES 1024   // bits / 8 * count; the JSON form stays under JSON_BUF_SIZE
+
+inline bool seedRequestValid(long bits, long count) {
+  return bits >= 32 && bits <= SEED_MAX_BITS && bits % 32 == 0 && count >= 1 &&
+         bits / 8 * count <= SEED_MAX_BYTES;
+}
+
+struct SeedReply {
+  uint8_t raw[SEED_MAX_BYTES];
+  uint16_t bits;
+  uint16_t count;
+  const char* source;  // entropySource label
+
+  size_t seedBytes() const { return bits / 8; }
+
+  // {"bits":64,"seeds":["<hex>",...],"entropySource":"TRNG"}; seeds are
+  // big-endian hex so hosts without 64-bit integers read them losslessly
+  void toJSON(JsonOut& out) const {
+    static const char hex[] = "0123456789abcdef";
+    out.write("{\"bits\":");
+    out.writeU32(bits);
+    out.write(",\"seeds\":[");
+    for (uint16_t i = 0; i < count; i++) {
+      if (i > 0) out.write(',');
+      out.write('"');
+      const uint8_t* seed = raw + i * seedBytes();
+      for (size_t b = 0; b < seedBytes(); b++) {
+        out.write(hex[seed[b] >> 4]);
+        out.write(hex[seed[b] & 0x0F]);
+      }
+      out.write('"');
+    }
+    out.write("],\"entropySource\":\"");
+    out.write(source);
+    out.write("\"}");
+  }
+};
+
+// Caller validates with seedRequestValid()
+template <class Source>
+void seedReplyFor(Source& src, SeedReply& reply, int bits, int count, const char* source) {
+  reply.bits = (uint16_t)bits;
+  reply.count = (uint16_t)count;
+  reply.source = source;
+  trngFill(src, reply.raw, reply.seedBytes() * count);
+}
+
+#endif // DRAW_JSON_H
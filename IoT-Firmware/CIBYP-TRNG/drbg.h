@@ -0,0 +1,124 @@
+/*
+ * ChaCha20 DRBG for CIBYP-IoT-TRNG
+ * A deterministic random bit generator keyed from a health-tested entropy
+ * source, for consumers that need more bytes than the hardware RNG can supply.
+ * It is itself an entropy-source policy (entropy_core.h), so the samplers and
+ * draws work on it unchanged.
+ *
+ *   - seed/reseed: 256 bits from the seed source are XORed into the key
+ *   - generate: ChaCha20 blocks in batches; the first 32 bytes of every batch
+ *     become the next key and are never output (fast key erasure), so a later
+ *     state compromise does not expose earlier output
+ *   - reseed after `reseedInterval` output bytes (DRBG_RESEED_BYTES by default)
+ *     and whenever a health test has tripped since the last seeding
+ */
+
+#ifndef DRBG_H
+#define DRBG_H
+
+#include "entropy_core.h"
+
+#define ENTROPY_SOURCE_DRBG "TRNG-DRBG"  // entropySource label for DRBG output
+
+#ifndef DRBG_RESEED_BYTES
+#define DRBG_RESEED_BYTES (1UL << 20)  // 1 MiB of output per seed
+#endif
+#define DRBG_BATCH_BLOCKS 8              // 512-byte batches, 480 bytes output each
+#define DRBG_BATCH_WORDS  (16 * DRBG_BATCH_BLOCKS)
+#define DRBG_KEY_WORDS    8
+
+#define CHACHA_ROTL(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+#define CHACHA_QR(a, b, c, d) \
+  a += b; d ^= a; d = CHACHA_ROTL(d, 16); \
+  c += d; b ^= c; b = CHACHA_ROTL(b, 12); \
+  a += b; d ^= a; d = CHACHA_ROTL(d, 8);  \
+  c += d; b ^= c; b = CHACHA_ROTL(b, 7);
+
+// One ChaCha20 block (RFC 8439 §2.3). `ctr` is state words 12-15: block counter
+// and nonce; output words are little-endian on every ESP32 and x86 host.
+inline void chacha20Block(const uint32_t key[8], const uint32_t ctr[4], uint32_t out[16]) {
+  uint32_t x[16] = {
+    0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+    key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+    ctr[0], ctr[1], ctr[2], ctr[3]
+  };
+  uint32_t s[16];
+  memcpy(s, x, sizeof(x));
+  for (int i = 0; i < 10; i++) {
+    CHACHA_QR(x[0], x[4], x[8], x[12]);
+    CHACHA_QR(x[1], x[5], x[9], x[13]);
+    CHACHA_QR(x[2], x[6], x[10], x[14]);
+    CHACHA_QR(x[3], x[7], x[11], x[15]);
+    CHACHA_QR(x[0], x[5], x[10], x[15]);
+    CHACHA_QR(x[1], x[6], x[11], x[12]);
+    CHACHA_QR(x[2], x[7], x[8], x[13]);
+    CHACHA_QR(x[3], x[4], x[9], x[14]);
+  }
+  for (int i = 0; i < 16; i++) out[i] = x[i] + s[i];
+}
+
+#undef CHACHA_QR
+#undef CHACHA_ROTL
+
+template <class Seed>
+struct DrbgSource : EntropySource<DrbgSource<Seed>> {
+  Seed* seed;
+  uint32_t reseedInterval = DRBG_RESEED_BYTES;
+  StatCounter reseeds;
+  StatCounter64 bytesGenerated;
+
+  uint32_t key[DRBG_KEY_WORDS] = {};
+  uint64_t counter = 0;
+  uint32_t batch[DRBG_BATCH_WORDS];
+  uint32_t pos = DRBG_BATCH_WORDS;      // next unread word of `batch`
+  uint32_t sinceReseed = 0;             // output bytes since the last seeding
+  uint32_t seedTrips = 0;               // healthTrips when last seeded
+  bool seeded = false;
+
+  explicit DrbgSource(Seed& s) : seed(&s) {}
+
+  void reseed() {
+    seedTrips = healthTrips.load(std::memory_order_acquire);
+    for (int i = 0; i < DRBG_KEY_WORDS; i++) key[i] ^= trngRead32(*seed);
+    pos = DRBG_BATCH_WORDS;
+    sinceReseed = 0;
+    seeded = true;
+    reseeds++;
+  }
+
+  void generateBatch() {
+    if (!seeded || sinceReseed >= reseedInterval ||
+        healthTrips.load(std::memory_order_acquire) != seedTrips) {
+      reseed();
+    }
+    for (int b = 0; b < DRBG_BATCH_BLOCKS; b++, counter++) {
+      uint32_t ctr[4] = { (uint32_t)counter, (uint32_t)(counter >> 32), 0, 0 };
+      chacha20Block(key, ctr, batch + b * 16);
+    }
+    memcpy(key, batch, sizeof(key));
+    memset(batch, 0, sizeof(key));
+    pos = DRBG_KEY_WORDS;
+    sinceReseed += (DRBG_BATCH_WORDS - DRBG_KEY_WORDS) * 4;
+  }
+
+  uint32_t next() {
+    if (pos >= DRBG_BATCH_WORDS) generateBatch();
+    bytesGenerated += 4;
+    return batch[pos++];
+  }
+
+  void fill(uint8_t* out, size_t len) {
+    bytesGenerated += len;
+    while (len > 0) {
+      if (pos >= DRBG_BATCH_WORDS) generateBatch();
+      size_t avail = (DRBG_BATCH_WORDS - pos) * 4;
+      size_t n = len < avail ? len : avail;
+      memcpy(out, batch + pos, n);
+      pos += (uint32_t)((n + 3) / 4);  // a partial word is discarded, never reused
+      out += n;
+      len -= n;
+    }
+  }
+};
+
+#endif // DRBG_H
@@ -0,0 +1,407 @@
+/*
+ * Entropy core for CIBYP-IoT-TRNG
+ * SP 800-90B health tests, the per-consumer entropy channel, the bit reservoir
+ * and unbiased sampler, and card drawing. Nothing here touches FreeRTOS, WiFi
+ * or the serial port: the only hardware dependency is esp_random() /
+ * esp_fill_random(), so the same code also builds natively (IoT-Firmware/native)
+ * against a software stand-in for unit tests and benchmarks.
+ */
+
+#ifndef ENTROPY_CORE_H
+#define ENTROPY_CORE_H
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <esp_random.h>
+
+// ---- Health Tests ----
+// NIST SP 800-90B §4.4 continuous tests on every harvested RNG word, treated as
+// four 8-bit samples with an assessed min-entropy of 7 bits per byte and a
+// false-positive rate of 2^-40 per sample:
+//   Repetition Count Test:    fail on 7 identical bytes in a row (1 + ceil(40 / 7))
+//   Adaptive Proportion Test: fail when the first byte of a 512-byte window
+//                             recurs 26 times in it (1 + CRITBINOM(512, 2^-7, 1 - 2^-40))
+// A trip fails closed: the producer stops publishing, consumers drop whatever is
+// left in their rings, and requests are refused until a fresh 1024-sample
+// start-up test (§4.3) passes.
+#define HEALTH_RCT_CUTOFF       7
+#define HEALTH_APT_WINDOW       512
+#define HEALTH_APT_CUTOFF       26
+#define HEALTH_STARTUP_SAMPLES  1024
+
+struct HealthTest {
+  uint8_t rctValue = 0;
+  uint8_t rctCount = 0;
+  uint8_t aptValue = 0;
+  uint16_t aptCount = 0;
+  uint16_t aptSeen = HEALTH_APT_WINDOW;  // first sample opens a window
+  uint32_t rctFailures = 0;
+  uint32_t aptFailures = 0;
+
+  bool sample(uint8_t b) {
+    bool ok = true;
+    if (b == rctValue && rctCount > 0) {
+      if (++rctCount >= HEALTH_RCT_CUTOFF) {
+        rctFailures++;
+        rctCount = 1;
+        ok = false;
+      }
+    } else {
+      rctValue = b;
+      rctCount = 1;
+    }
+    if (aptSeen >= HEALTH_APT_WINDOW) {
+      aptValue = b;
+      aptCount = 1;
+      aptSeen = 1;
+    } else {
+      aptSeen++;
+      if (b == aptValue && ++aptCount >= HEALTH_APT_CUTOFF) {
+        aptFailures++;
+        aptSeen = HEALTH_APT_WINDOW;
+        ok = false;
+      }
+    }
+    return ok;
+  }
+
+  bool word(uint32_t w) {
+    bool ok = sample((uint8_t)w);
+    ok &= sample((uint8_t)(w >> 8));
+    ok &= sample((uint8_t)(w >> 16));
+    ok &= sample((uint8_t)(w >> 24));
+    return ok;
+  }
+};
+
+enum HealthState : uint8_t { HEALTH_STARTUP, HEALTH_OK, HEALTH_FAILED };
+inline std::atomic<uint8_t> healthState{HEALTH_STARTUP};
+inline std::atomic<uint32_t> healthTrips{0};  // consumers flush their ring when this moves
+inline HealthTest producerHealth;
+
+inline void healthTrip() {
+  healthState.store(HEALTH_FAILED, std::memory_order_release);
+  healthTrips.fetch_add(1, std::memory_order_acq_rel);
+}
+
+inline const char* healthStateName() {
+  switch (healthState.load(std::memory_order_acquire)) {
+    case HEALTH_OK: return "ok";
+    case HEALTH_STARTUP: return "startup";
+    default: return "failed";
+  }
+}
+
+// ---- Statistics Counters ----
+// Event counters are written only by the task that owns the source (async_tcp
+// for the HTTP channel, loop() for the serial one) and read from either by
+// /api/info and the metrics scrape. With a single writer an update needs no
+// read-modify-write: a relaxed load and store compile to plain word accesses,
+// as cheap as the old bare integers, and a reader never sees a torn value.
+struct StatCounter {
+  std::atomic<uint32_t> value{0};
+
+  uint32_t load() const { return value.load(std::memory_order_relaxed); }
+  operator uint32_t() const { return load(); }
+  StatCounter& operator+=(uint32_t n) {
+    value.store(load() + n, std::memory_order_relaxed);
+    return *this;
+  }
+  StatCounter& operator++() { return *this += 1; }
+  void operator++(int) { *this += 1; }
+};
+
+// 64-bit flavour for byte totals. 64-bit atomics are not lock-free on Xtensa,
+// so the value is two words and the high word doubles as a sequence number:
+// it is odd while a carry is being written, and readers retry across one.
+struct StatCounter64 {
+  std::atomic<uint32_t> low{0};
+  std::atomic<uint32_t> high{0};      // 2 * (value >> 32), +1 during a carry
+
+  uint64_t load() const {
+    for (;;) {
+      uint32_t h = high.load(std::memory_order_acquire);
+      uint32_t l = low.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (!(h & 1) && high.load(std::memory_order_relaxed) == h) return ((uint64_t)(h >> 1) << 32) | l;
+    }
+  }
+  operator uint64_t() const { return load(); }
+  StatCounter64& operator+=(uint32_t n) {
+    uint32_t l = low.load(std::memory_order_relaxed);
+    if ((uint32_t)(l + n) >= l) {
+      low.store(l + n, std::memory_order_relaxed);
+    } else {
+      uint32_t h = high.load(std::memory_order_relaxed);
+      high.store(h + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      low.store(l + n, std::memory_order_relaxed);
+      high.store(h + 2, std::memory_order_release);
+    }
+    return *this;
+  }
+};
+
+// ---- Entropy Sources ----
+// The samplers and card draws below are templates over an entropy-source
+// policy: any type deriving from EntropySource<Self> that provides
+// `uint32_t next()` (one fresh 32-bit word) and may provide
+// `void fill(uint8_t*, size_t)` for bulk reads. Every source/sampler pairing is
+// resolved and inlined at compile time, with no virtual dispatch. The base
+// holds the consumer-side bit reservoir and counters, so every source gets
+// them the same way.
+#define ENTROPY_SOURCE_TRNG "TRNG"   // entropySource label for direct reads
+
+template <class Self>
+struct EntropySource {
+  uint32_t bitReservoir = 0;
+  uint8_t bitReservoirCount = 0;
+  StatCounter wordsConsumed;          // 32-bit words taken by trngRead32
+  StatCounter drawWords;              // ...of which were spent on card draws
+  StatCounter cardsDrawn;
+  StatCounter bytesFilled;            // bytes taken by trngFill
+  StatCounter unbiasedRetries;        // samples trngUnbiased rejected
+
+  uint32_t read32() {
+    wordsConsumed++;
+    return static_cast<Self*>(this)->next();
+  }
+
+  void fill(uint8_t* buf, size_t len) {
+    Self& self = *static_cast<Self*>(this);
+    for (; len >= 4; buf += 4, len -= 4) {
+      uint32_t val = self.next();
+      memcpy(buf, &val, 4);
+    }
+    if (len > 0) {
+      uint32_t val = self.next();
+      memcpy(buf, &val, len);
+    }
+  }
+};
+
+// Hardware RNG read directly, every word health-tested
+struct HardwareSource : EntropySource<HardwareSource> {
+  HealthTest health;
+
+  uint32_t next() {
+    uint32_t val = esp_random(); // Hardware RNG on all ESP32 variants
+    if (!health.word(val)) healthTrip();
+    return val;
+  }
+
+  void fill(uint8_t* buf, size_t len) {
+    esp_fill_random(buf, len);
+    bool ok = true;
+    for (size_t i = 0; i < len; i++) ok &= health.sample(buf[i]);
+    if (!ok) healthTrip();
+  }
+};
+
+// ---- Entropy Channels ----
+// A buffered pool source: one single-producer/single-consumer ring of
+// health-tested RNG words per consumer context, falling back to the hardware
+// RNG when the ring is empty (the producer task and channel allocation live in
+// the sketch).
+#define POOL_REFILL_BATCH   64
+
+struct EntropyChannel : EntropySource<EntropyChannel> {
+  uint32_t* buf = nullptr;
+  uint32_t capacity = 0;              // power of two
+  std::atomic<uint32_t> head{0};      // advanced by the producer only
+  std::atomic<uint32_t> tail{0};      // advanced by the consumer only
+
+  // Consumer-side state, touched only by the channel's own reader
+  StatCounter underruns;              // reads that found the ring empty
+  HardwareSource fallback;            // direct, health-tested reads on underrun
+  uint32_t healthTripsSeen = 0;
+
+  uint32_t level() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed);
+  }
+
+  uint32_t next() {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t != head.load(std::memory_order_acquire)) {
+      uint32_t val = buf[t & (capacity - 1)];
+      tail.store(t + 1, std::memory_order_release);
+      return val;
+    }
+    underruns++;
+    return fallback.next();
+  }
+
+  // Copy from the ring, topping up straight from the RNG once it runs dry
+  void fill(uint8_t* out, size_t len) {
+    while (len >= 4) {
+      uint32_t t = tail.load(std::memory_order_relaxed);
+      uint32_t avail = head.load(std::memory_order_acquire) - t;
+      if (avail == 0) break;
+      uint32_t n = len / 4 < avail ? len / 4 : avail;
+      for (uint32_t i = 0; i < n; i++) {
+        uint32_t val = buf[(t + i) & (capacity - 1)];
+        memcpy(out + i * 4, &val, 4);
+      }
+      tail.store(t + n, std::memory_order_release);
+      out += n * 4;
+      len -= n * 4;
+    }
+    if (len > 0) {
+      if (len >= 4) underruns++;
+      fallback.fill(out, len);
+    }
+  }
+};
+
+// Top up one channel by at most a batch of health-tested words; returns the
+// number of words written. A batch that trips a test is never published.
+inline uint32_t refillChannel(EntropyChannel& ch) {
+  uint32_t head = ch.head.load(std::memory_order_relaxed);
+  uint32_t space = ch.capacity - (head - ch.tail.load(std::memory_order_acquire));
+  uint32_t n = space < POOL_REFILL_BATCH ? space : POOL_REFILL_BATCH;
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t w = esp_random();
+    if (!producerHealth.word(w)) {
+      healthTrip();
+      return 0;
+    }
+    ch.buf[(head + i) & (ch.capacity - 1)] = w;
+  }
+  if (n) ch.head.store(head + n, std::memory_order_release);
+  return n;
+}
+
+// ---- TRNG Core ----
+// Fail-closed checks for consumers. entropyHealthy() is false if a health test
+// has tripped since the channel last looked (dropping the ring and bit
+// reservoir contents) or is still failing; call it after drawing and discard
+// the result on false. entropyReady() is the pre-draw check: it syncs the same
+// way but only asks whether the source is currently healthy.
+inline bool entropyHealthy(EntropyChannel& ch) {
+  uint32_t trips = healthTrips.load(std::memory_order_acquire);
+  if (trips != ch.healthTripsSeen) {
+    ch.healthTripsSeen = trips;
+    ch.tail.store(ch.head.load(std::memory_order_acquire), std::memory_order_release);
+    ch.bitReservoirCount = 0;
+    return false;
+  }
+  return healthState.load(std::memory_order_acquire) == HEALTH_OK;
+}
+
+inline bool entropyReady(EntropyChannel& ch) {
+  return entropyHealthy(ch) || healthState.load(std::memory_order_acquire) == HEALTH_OK;
+}
+
+template <class Source>
+uint32_t trngRead32(Source& src) {
+  return src.read32();
+}
+
+// Bit reservoir: each decision takes exactly the bits it needs and the rest of
+// the word stays available for the next one.
+// Next n (1-32) random bits, low-aligned
+template <class Source>
+uint32_t trngBits(Source& src, uint8_t n) {
+  uint32_t out = 0;
+  uint8_t got = 0;
+  while (got < n) {
+    if (src.bitReservoirCount == 0) {
+      src.bitReservoir = src.read32();
+      src.bitReservoirCount = 32;
+    }
+    uint8_t take = n - got;
+    if (take > src.bitReservoirCount) take = src.bitReservoirCount;
+    uint32_t mask = take == 32 ? 0xFFFFFFFF : ((1UL << take) - 1);
+    out |= (src.bitReservoir & mask) << got;
+    src.bitReservoir = take == 32 ? 0 : src.bitReservoir >> take;
+    src.bitReservoirCount -= take;
+    got += take;
+  }
+  return out;
+}
+
+template <class Source>
+uint8_t trngReadByte(Source& src) {
+  return (uint8_t)trngBits(src, 8);
+}
+
+template <class Source>
+void trngFill(Source& src, uint8_t* buf, size_t len) {
+  src.bytesFilled += len;
+  src.fill(buf, len);
+}
+
+// Unbiased random in range [0, range) using Lemire's nearly-divisionless
+// multiply-shift: the high half of sample * range is the result, and only the
+// rare samples whose low half falls under (2^k - range) % range are rejected.
+// Ranges up to 256 use 16-bit samples from the bit reservoir (two decisions per
+// RNG word, rejection odds below 0.4%); larger ranges use full 32-bit words.
+template <class Source>
+uint32_t trngUnbiased(Source& src, uint32_t range) {
+  if (range <= 1) return 0;
+  if (range <= 256) {
+    uint32_t m = trngBits(src, 16) * range;
+    if ((m & 0xFFFF) < range) {
+      uint32_t threshold = (0x10000 - range) % range;
+      while ((m & 0xFFFF) < threshold) {
+        src.unbiasedRetries++;
+        m = trngBits(src, 16) * range;
+      }
+    }
+    return m >> 16;
+  }
+  uint64_t m = (uint64_t)trngRead32(src) * range;
+  if ((uint32_t)m < range) {
+    uint32_t threshold = (0U - range) % range;
+    while ((uint32_t)m < threshold) {
+      src.unbiasedRetries++;
+      m = (uint64_t)trngRead32(src) * range;
+    }
+  }
+  return (uint32_t)(m >> 32);
+}
+
+// ---- Draw a single card ----
+struct DrawResult {
+  uint8_t cardIndex;
+  bool isReversed;
+};
+
+// Card index and orientation come from a single draw over 78 * 2 outcomes
+template <class Source>
+DrawResult drawSingleCard(Source& src) {
+  uint32_t startWords = src.wordsConsumed;
+  uint32_t v = trngUnbiased(src, 78 * 2);
+  DrawResult r;
+  r.cardIndex = (uint8_t)(v >> 1);
+  r.isReversed = v & 1;
+  src.drawWords += src.wordsConsumed - startWords;
+  src.cardsDrawn++;
+  return r;
+}
+
+// Draw multiple unique cards with a partial Fisher-Yates shuffle: position i
+// swaps in a uniform pick from the 78 - i cards not yet drawn, so every ordered
+// selection of `count` cards is equally likely and no draw is ever retried.
+// The orientation bit rides along in the same bounded draw.
+template <class Source>
+void drawMultipleCards(Source& src, DrawResult* results, int count) {
+  if (count > 78) count = 78;
+  uint32_t startWords = src.wordsConsumed;
+  uint8_t deck[78];
+  for (int i = 0; i < 78; i++) deck[i] = (uint8_t)i;
+  for (int i = 0; i < count; i++) {
+    uint32_t v = trngUnbiased(src, (78 - i) * 2);
+    uint8_t j = (uint8_t)(i + (v >> 1));
+    uint8_t picked = deck[j];
+    deck[j] = deck[i];
+    deck[i] = picked;
+    results[i].cardIndex = picked;
+    results[i].isReversed = v & 1;
+  }
+  src.drawWords += src.wordsConsumed - startWords;
+  src.cardsDrawn += count;
+}
+
+#endif // ENTROPY_CORE_H
@@ -0,0 +1,111 @@
+/*
+ * Server-sent event stream for CIBYP-IoT-TRNG
+ * State of one /api/stream client: a paced sequence of SSE events, either
+ * "random" blocks (hex) or "draw" replies (the same JSON as /api/draw and
+ * /api/spread), read from a channel or its DRBG. The sketch's chunked-response
+ * filler calls fill() whenever the TCP send buffer has room, so a client that
+ * stops reading stops being fed (TCP flow control does the throttling) and
+ * slots it fell too far behind on are skipped instead of bursted later. Each
+ * event is regenerated window by window like a draw reply, so a large event
+ * needs no buffer of its own.
+ */
+
+#ifndef EVENT_STREAM_H
+#define EVENT_STREAM_H
+
+#include "draw_json.h"
+#include "drbg.h"
+
+#define EVENT_STREAM_MAX_BLOCK 1024   // bytes per random event
+#define EVENT_STREAM_MAX_RATE 100     // events per second
+#define EVENT_STREAM_MAX_LAG_MS 1000  // later than this, missed slots are dropped
+
+constexpr size_t EVENT_STREAM_WAIT = (size_t)-1;  // nothing due yet
+
+struct EntropyEventStream {
+  enum Kind : uint8_t { RANDOM, DRAW };
+
+  EntropyChannel& ch;
+  DrbgSource<EntropyChannel>* drbg;  // nullptr: read the channel itself
+  Kind kind = RANDOM;
+  uint16_t blockBytes = 32;
+  int drawCount = 1;
+  const char* spreadName = nullptr;
+  const char* spreadId = nullptr;
+  uint32_t intervalMs = 100;
+  uint32_t remaining = 0;            // events left when `limited`
+  bool limited = false;
+
+  uint32_t seq = 0;
+  uint32_t nextDueMs = 0;
+  bool started = false;
+  size_t eventLen = 0;
+  size_t eventSent = 0;
+  DrawReply reply;
+  uint8_t block[EVENT_STREAM_MAX_BLOCK];
+
+  EntropyEventStream(EntropyChannel& c, DrbgSource<EntropyChannel>* d) : ch(c), drbg(d) {}
+
+  void render(JsonOut& out) const {
+    out.write("id: ");
+    out.writeU32(seq);
+    if (kind == RANDOM) {
+      static const char hex[] = "0123456789abcdef";
+      out.write("\nevent: random\ndata: ");
+      for (uint16_t i = 0; i < blockBytes; i++) {
+        out.write(hex[block[i] >> 4]);
+        out.write(hex[block[i] & 0x0F]);
+      }
+    } else {
+      out.write("\nevent: draw\ndata: ");
+      reply.toJSON(out);
+    }
+    out.write("\n\n");
+  }
+
+  // Draws the next event; false (and nothing queued) if the source is failing
+  bool nextEvent() {
+    if (!entropyReady(ch)) return false;
+    if (kind == RANDOM) {
+      if (drbg) trngFill(*drbg, block, blockBytes);
+      else trngFill(ch, block, blockBytes);
+    } else if (drbg) {
+      drawReplyFor(*drbg, reply, drawCount, spreadName, spreadId, ENTROPY_SOURCE_DRBG);
+    } else {
+      drawReplyFor(ch, reply, drawCount, spreadName, spreadId);
+    }
+    if (!entropyHealthy(ch)) return false;
+    seq++;
+    if (limited) remaining--;
+    JsonOut sizing(nullptr, 0);
+    render(sizing);
+    eventLen = sizing.pos;
+    eventSent = 0;
+    return true;
+  }
+
+  // Writes up to maxLen bytes of the stream at time nowMs. Returns the bytes
+  // written, 0 once a limited stream is complete, or EVENT_STREAM_WAIT when
+  // nothing was written because no event is due or the source is re-testing.
+  size_t fill(uint8_t* buf, size_t maxLen, uint32_t nowMs) {
+    size_t written = 0;
+    while (written < maxLen) {
+      if (eventSent == eventLen) {
+        if (limited && remaining == 0) break;
+        if (started && (int32_t)(nowMs - nextDueMs) < 0) break;
+        if (!started || (int32_t)(nowMs - nextDueMs) > EVENT_STREAM_MAX_LAG_MS) nextDueMs = nowMs;
+        if (!nextEvent()) break;
+        started = true;
+        nextDueMs += intervalMs;
+      }
+      JsonOut out((char*)buf + written, maxLen - written, eventSent);
+      render(out);
+      eventSent += out.len;
+      written += out.len;
+    }
+    if (written) return written;
+    return limited && remaining == 0 && eventSent == eventLen ? 0 : EVENT_STREAM_WAIT;
+  }
+};
+
+#endif // EVENT_STREAM_H
@@ -0,0 +1,291 @@
+/*
+ * Runtime metrics for CIBYP-IoT-TRNG
+ * Fixed-bucket latency histograms for every HTTP route and serial command and
+ * the Prometheus text exposition behind /api/metrics and METRICS. Recording is
+ * a couple of relaxed atomic increments, lock-free from any task; a scrape
+ * copies everything into a MetricsSnapshot and renders that through JsonOut,
+ * window by window like a draw reply, so one response is self-consistent.
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <atomic>
+
+#include "draw_json.h"
+
+// X(id, label): one histogram per route, unmatched requests count as "other"
+#define METRIC_ROUTE_LIST(X) \
+  X(root, "/") \
+  X(draw, "/api/draw") \
+  X(spread, "/api/spread") \
+  X(spreads, "/api/spreads") \
+  X(random, "/api/random") \
+  X(seed, "/api/seed") \
+  X(stream, "/api/stream") \
+  X(config, "/api/config") \
+  X(info, "/api/info") \
+  X(health, "/api/health") \
+  X(bench, "/api/bench") \
+  X(ota, "/api/ota") \
+  X(metrics, "/api/metrics") \
+  X(other, "other")
+
+// X(name): one histogram per serial command word, unknown words count as "other"
+#define METRIC_SERIAL_LIST(X) \
+  X(HELLO) X(BAUD) X(FMT) X(DRAW) X(SPREAD) X(SPREADS) X(RANDOM) X(SEED) \
+  X(STREAM) X(INFO) X(HEALTH) X(BENCH) X(PING) X(METRICS) X(other)
+
+#define METRIC_ROUTE_INDEX(id, label) METRIC_ROUTE_##id,
+enum MetricRoute : uint8_t { METRIC_ROUTE_LIST(METRIC_ROUTE_INDEX) METRIC_ROUTE_COUNT };
+#undef METRIC_ROUTE_INDEX
+
+#define METRIC_SERIAL_INDEX(name) METRIC_SERIAL_##name,
+enum MetricSerial : uint8_t { METRIC_SERIAL_LIST(METRIC_SERIAL_INDEX) METRIC_SERIAL_COUNT };
+#undef METRIC_SERIAL_INDEX
+
+#define METRIC_ROUTE_LABEL(id, label) label,
+constexpr const char* METRIC_ROUTE_LABELS[METRIC_ROUTE_COUNT] = { METRIC_ROUTE_LIST(METRIC_ROUTE_LABEL) };
+#undef METRIC_ROUTE_LABEL
+
+#define METRIC_SERIAL_LABEL(name) #name,
+constexpr const char* METRIC_SERIAL_LABELS[METRIC_SERIAL_COUNT] = { METRIC_SERIAL_LIST(METRIC_SERIAL_LABEL) };
+#undef METRIC_SERIAL_LABEL
+
+// Histogram slot for a serial command word
+inline MetricSerial metricSerialFor(const char* name) {
+  for (uint8_t i = 0; i < METRIC_SERIAL_other; i++) {
+    if (strcmp(name, METRIC_SERIAL_LABELS[i]) == 0) return (MetricSerial)i;
+  }
+  return METRIC_SERIAL_other;
+}
+
+// Upper bounds in microseconds with their Prometheus "le" labels; anything
+// slower lands in the implicit +Inf bucket
+struct LatencyBucket {
+  uint32_t us;
+  const char* le;
+};
+
+constexpr LatencyBucket LATENCY_BUCKETS[] = {
+  {100, "0.0001"}, {250, "0.00025"}, {500, "0.0005"}, {1000, "0.001"}, {2500, "0.0025"},
+  {5000, "0.005"}, {10000, "0.01"}, {25000, "0.025"}, {50000, "0.05"}, {100000, "0.1"},
+  {250000, "0.25"}, {1000000, "1"},
+};
+constexpr size_t LATENCY_BUCKET_COUNT = sizeof(LATENCY_BUCKETS) / sizeof(LATENCY_BUCKETS[0]);
+
+// Plain copy of one histogram; buckets are per bucket (not cumulative), the
+// last one is +Inf
+struct HistogramCounts {
+  uint32_t buckets[LATENCY_BUCKET_COUNT + 1];
+  uint32_t count;
+  uint64_t sumUs;
+};
+
+struct LatencyHistogram {
+  std::atomic<uint32_t> buckets[LATENCY_BUCKET_COUNT + 1]{};
+  std::atomic<uint32_t> sumUs{0};
+  std::atomic<uint32_t> sumWraps{0};  // sumUs overflows after ~71 minutes of handler time
+
+  void record(uint32_t us) {
+    size_t i = 0;
+    while (i < LATENCY_BUCKET_COUNT && us > LATENCY_BUCKETS[i].us) i++;
+    buckets[i].fetch_add(1, std::memory_order_relaxed);
+    uint32_t before = sumUs.fetch_add(us, std::memory_order_relaxed);
+    if ((uint32_t)(before + us) < before) sumWraps.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // The count is the sum of the copied buckets, so it always matches them
+  HistogramCounts snapshot() const {
+    HistogramCounts h;
+    h.count = 0;
+    for (size_t i = 0; i <= LATENCY_BUCKET_COUNT; i++) {
+      h.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+      h.count += h.buckets[i];
+    }
+    h.sumUs = ((uint64_t)sumWraps.load(std::memory_order_relaxed) << 32) | sumUs.load(std::memory_order_relaxed);
+    return h;
+  }
+};
+
+// Live histograms; the sketch keeps one instance
+struct MetricsRegistry {
+  LatencyHistogram routes[METRIC_ROUTE_COUNT];
+  LatencyHistogram serial[METRIC_SERIAL_COUNT];
+};
+
+// Consumer-side counters of one entropy channel; draws and rejections made
+// through the channel's DRBG count towards the channel
+struct ChannelCounters {
+  const char* name;
+  uint64_t wordsConsumed;
+  uint64_t bytesFilled;
+  uint64_t unbiasedRetries;
+  uint64_t cardsDrawn;
+  uint64_t underruns;
+  uint64_t drbgReseeds;
+  uint64_t drbgBytes;
+};
+
+template <class Channel, class Drbg>
+ChannelCounters channelCounters(const char* name, const Channel& ch, const Drbg& drbg) {
+  return { name, ch.wordsConsumed, ch.bytesFilled, (uint64_t)ch.unbiasedRetries + drbg.unbiasedRetries,
+           (uint64_t)ch.cardsDrawn + drbg.cardsDrawn, ch.underruns, drbg.reseeds, drbg.bytesGenerated };
+}
+
+#define METRIC_CHANNEL_COUNT 2
+
+inline void metricU64(JsonOut& out, uint64_t v) {
+  char tmp[20];
+  int n = 0;
+  do {
+    tmp[n++] = (char)('0' + v % 10);
+    v /= 10;
+  } while (v);
+  while (n > 0) out.write(tmp[--n]);
+}
+
+// Microseconds as decimal seconds, e.g. 1234567 -> "1.234567"
+inline void metricSeconds(JsonOut& out, uint64_t us) {
+  metricU64(out, us / 1000000);
+  char frac[8] = {'.'};
+  uint32_t f = (uint32_t)(us % 1000000);
+  for (int i = 6; i >= 1; i--, f /= 10) frac[i] = (char)('0' + f % 10);
+  out.write(frac, 7);
+}
+
+inline void metricHeader(JsonOut& out, const char* name, const char* type, const char* help) {
+  out.write("# HELP ");
+  out.write(name);
+  out.write(' ');
+  out.write(help);
+  out.write("\n# TYPE ");
+  out.write(name);
+  out.write(' ');
+  out.write(type);
+  out.write('\n');
+}
+
+// Series name with its labels and the separating space:
+// name<suffix>{label="value",le="..."} ; label and le may be nullptr
+inline void metricSeries(JsonOut& out, const char* name, const char* suffix, const char* label, const char* value,
+                         const char* le = nullptr) {
+  out.write(name);
+  if (suffix) out.write(suffix);
+  if (label || le) {
+    out.write('{');
+    if (label) {
+      out.write(label);
+      out.write("=\"");
+      out.write(value);
+      out.write('"');
+    }
+    if (le) {
+      out.write(label ? ",le=\"" : "le=\"");
+      out.write(le);
+      out.write('"');
+    }
+    out.write('}');
+  }
+  out.write(' ');
+}
+
+inline void metricSample(JsonOut& out, const char* name, const char* label, const char* value, uint64_t v) {
+  metricSeries(out, name, nullptr, label, value);
+  metricU64(out, v);
+  out.write('\n');
+}
+
+inline void metricHistogram(JsonOut& out, const char* name, const char* label, const char* value, const HistogramCounts& h) {
+  uint32_t cumulative = 0;
+  for (size_t i = 0; i <= LATENCY_BUCKET_COUNT; i++) {
+    cumulative += h.buckets[i];
+    metricSeries(out, name, "_bucket", label, value, i < LATENCY_BUCKET_COUNT ? LATENCY_BUCKETS[i].le : "+Inf");
+    out.writeU32(cumulative);
+    out.write('\n');
+  }
+  metricSeries(out, name, "_sum", label, value);
+  metricSeconds(out, h.sumUs);
+  out.write('\n');
+  metricSeries(out, name, "_count", label, value);
+  out.writeU32(h.count);
+  out.write('\n');
+}
+
+// Everything one scrape reports, copied at scrape time
+struct MetricsSnapshot {
+  HistogramCounts routes[METRIC_ROUTE_COUNT];
+  HistogramCounts serial[METRIC_SERIAL_COUNT];
+  ChannelCounters channels[METRIC_CHANNEL_COUNT];
+  uint32_t uptimeSeconds;
+  uint32_t healthTrips;
+  bool healthy;
+  uint32_t poolRefillWordsPerSec;
+  uint64_t randomBytesServed;
+  uint32_t streamClients;
+  uint32_t streamEventsSent;
+  uint32_t heapFree;
+  uint32_t heapMinFree;
+  uint32_t heapMaxAlloc;
+
+  void captureHistograms(const MetricsRegistry& r) {
+    for (size_t i = 0; i < METRIC_ROUTE_COUNT; i++) routes[i] = r.routes[i].snapshot();
+    for (size_t i = 0; i < METRIC_SERIAL_COUNT; i++) serial[i] = r.serial[i].snapshot();
+  }
+
+  // Prometheus text exposition format 0.0.4
+  void toPrometheus(JsonOut& out) const {
+    metricHeader(out, "trng_http_request_duration_seconds", "histogram",
+                 "Handler time per route until the response is queued.");
+    for (size_t i = 0; i < METRIC_ROUTE_COUNT; i++) {
+      metricHistogram(out, "trng_http_request_duration_seconds", "route", METRIC_ROUTE_LABELS[i], routes[i]);
+    }
+    metricHeader(out, "trng_serial_command_duration_seconds", "histogram",
+                 "Time per serial command until its reply is buffered.");
+    for (size_t i = 0; i < METRIC_SERIAL_COUNT; i++) {
+      metricHistogram(out, "trng_serial_command_duration_seconds", "command", METRIC_SERIAL_LABELS[i], serial[i]);
+    }
+
+    struct ChannelMetric {
+      const char* name;
+      const char* help;
+      uint64_t ChannelCounters::*value;
+    };
+    static const ChannelMetric channelMetrics[] = {
+      {"trng_rng_words_consumed_total", "32-bit RNG words read by the samplers.", &ChannelCounters::wordsConsumed},
+      {"trng_rng_bytes_filled_total", "RNG bytes read in bulk.", &ChannelCounters::bytesFilled},
+      {"trng_unbiased_retries_total", "Samples rejected by trngUnbiased.", &ChannelCounters::unbiasedRetries},
+      {"trng_cards_drawn_total", "Cards drawn.", &ChannelCounters::cardsDrawn},
+      {"trng_pool_underruns_total", "Reads that found the entropy pool empty.", &ChannelCounters::underruns},
+      {"trng_drbg_reseeds_total", "DRBG reseeds.", &ChannelCounters::drbgReseeds},
+      {"trng_drbg_bytes_total", "DRBG output bytes.", &ChannelCounters::drbgBytes},
+    };
+    for (const ChannelMetric& m : channelMetrics) {
+      metricHeader(out, m.name, "counter", m.help);
+      for (const ChannelCounters& c : channels) metricSample(out, m.name, "channel", c.name, c.*m.value);
+    }
+
+    metricHeader(out, "trng_health_trips_total", "counter", "RNG health test trips.");
+    metricSample(out, "trng_health_trips_total", nullptr, nullptr, healthTrips);
+    metricHeader(out, "trng_healthy", "gauge", "1 while the RNG passes its health tests.");
+    metricSample(out, "trng_healthy", nullptr, nullptr, healthy ? 1 : 0);
+    metricHeader(out, "trng_pool_refill_words_per_second", "gauge", "Words harvested into the pools over the last second.");
+    metricSample(out, "trng_pool_refill_words_per_second", nullptr, nullptr, poolRefillWordsPerSec);
+    metricHeader(out, "trng_random_bytes_served_total", "counter", "Bytes served by /api/random?bytes=N.");
+    metricSample(out, "trng_random_bytes_served_total", nullptr, nullptr, randomBytesServed);
+    metricHeader(out, "trng_stream_clients", "gauge", "Open /api/stream connections.");
+    metricSample(out, "trng_stream_clients", nullptr, nullptr, streamClients);
+    metricHeader(out, "trng_stream_events_total", "counter", "Events sent on /api/stream.");
+    metricSample(out, "trng_stream_events_total", nullptr, nullptr, streamEventsSent);
+    metricHeader(out, "trng_heap_free_bytes", "gauge", "Free heap.");
+    metricSample(out, "trng_heap_free_bytes", nullptr, nullptr, heapFree);
+    metricHeader(out, "trng_heap_min_free_bytes", "gauge", "Lowest free heap since boot.");
+    metricSample(out, "trng_heap_min_free_bytes", nullptr, nullptr, heapMinFree);
+    metricHeader(out, "trng_heap_max_alloc_bytes", "gauge", "Largest free heap block.");
+    metricSample(out, "trng_heap_max_alloc_bytes", nullptr, nullptr, heapMaxAlloc);
+    metricHeader(out, "trng_uptime_seconds", "gauge", "Seconds since boot.");
+    metricSample(out, "trng_uptime_seconds", nullptr, nullptr, uptimeSeconds);
+  }
+};
+
+#endif // METRICS_H
@@ -0,0 +1,143 @@
+/*
+ * Serial command reader and parser for CIBYP-IoT-TRNG
+ * Input lines accumulate in a fixed buffer (bounded length, no heap) and are
+ * tokenized in place: a line holds one or more ';'-separated commands, each
+ * "[#<id> ]NAME[:<arg>]", and the parser terminates the id, name and argument
+ * inside the line buffer and points at them instead of copying. Dispatch stays
+ * in the sketch; everything here is plain C strings, so it is unit tested and
+ * benchmarked natively as well.
+ */
+
+#ifndef SERIAL_COMMAND_H
+#define SERIAL_COMMAND_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define SERIAL_LINE_MAX 512   // longest accepted input line, batches included
+
+// Line rates BAUD:<n> accepts, ascending; the first is the power-on rate.
+// 1.5 Mbaud and up need a bridge that supports them (CP2102N, CH343, FT232H).
+constexpr uint32_t SERIAL_BAUD_RATES[] = { 115200, 230400, 460800, 921600, 1500000, 2000000, 3000000 };
+constexpr size_t SERIAL_BAUD_RATE_COUNT = sizeof(SERIAL_BAUD_RATES) / sizeof(SERIAL_BAUD_RATES[0]);
+
+inline bool serialBaudSupported(uint32_t baud) {
+  for (uint32_t rate : SERIAL_BAUD_RATES) {
+    if (rate == baud) return true;
+  }
+  return false;
+}
+
+inline bool serialIsSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Trims `s` in place: returns the first non-space character and terminates
+// the string after the last one
+inline char* trimInPlace(char* s) {
+  while (serialIsSpace(*s)) s++;
+  char* end = s + strlen(s);
+  while (end > s && serialIsSpace(end[-1])) *--end = '\0';
+  return s;
+}
+
+// Splits `s` at the first `sep` in place; returns the trimmed text after it,
+// or nullptr when `sep` does not occur
+inline char* splitAt(char* s, char sep) {
+  char* at = strchr(s, sep);
+  if (!at) return nullptr;
+  *at = '\0';
+  trimInPlace(s);
+  return trimInPlace(at + 1);
+}
+
+struct SerialCommand {
+  bool valid = true;       // false: the "#<id>" prefix is not a decimal u32
+  bool hasId = false;
+  uint32_t id = 0;
+  char* name = nullptr;    // command word, e.g. "DRAW"
+  char* arg = nullptr;     // text after the first ':', trimmed; nullptr when absent
+
+  bool hasArg() const { return arg != nullptr; }
+  bool named(const char* n) const { return strcmp(name, n) == 0; }
+  bool is(const char* n) const { return !arg && named(n); }
+  bool isWithArg(const char* n) const { return arg && named(n); }
+};
+
+// Tokenizes one command in place; name and arg point into `seg`
+inline SerialCommand parseSerialCommand(char* seg) {
+  SerialCommand c;
+  char* s = trimInPlace(seg);
+  if (*s == '#') {
+    char* p = s + 1;
+    uint64_t v = 0;
+    int digits = 0;
+    while (*p >= '0' && *p <= '9' && digits <= 10) {
+      v = v * 10 + (uint64_t)(*p++ - '0');
+      digits++;
+    }
+    if (digits == 0 || digits > 10 || v > 0xFFFFFFFFULL || (*p != '\0' && !serialIsSpace(*p))) {
+      c.valid = false;
+      c.name = p + strlen(p);
+      return c;
+    }
+    c.hasId = true;
+    c.id = (uint32_t)v;
+    s = trimInPlace(p);
+  }
+  c.name = s;
+  c.arg = splitAt(s, ':');
+  return c;
+}
+
+// Calls fn(segment) for every non-empty ';'-separated command of `line`, in
+// order, until fn returns false
+template <class F>
+void forEachSerialCommand(char* line, F&& fn) {
+  char* seg = line;
+  while (seg) {
+    char* next = strchr(seg, ';');
+    if (next) *next++ = '\0';
+    char* cmd = trimInPlace(seg);
+    if (*cmd && !fn(cmd)) return;
+    seg = next;
+  }
+}
+
+// Fixed-size line assembler fed one received byte at a time. Lines longer than
+// SERIAL_LINE_MAX are truncated and flagged so the caller can reject them whole.
+struct SerialLineReader {
+  char line[SERIAL_LINE_MAX + 1];
+  uint16_t len = 0;
+  bool overflow = false;
+  bool complete = false;
+
+  // True when `c` ends a non-empty line, now NUL-terminated in `line`; the
+  // line stays valid until the next push
+  bool push(char c) {
+    if (complete) {
+      len = 0;
+      overflow = false;
+      complete = false;
+    }
+    if (c == '\n' || c == '\r') {
+      if (len == 0 && !overflow) return false;
+      line[len] = '\0';
+      complete = true;
+      return true;
+    }
+    if (len < SERIAL_LINE_MAX) line[len++] = c;
+    else overflow = true;
+    return false;
+  }
+
+  // Drops any partial line, e.g. bytes garbled by a line-rate change
+  void reset() {
+    len = 0;
+    overflow = false;
+    complete = false;
+  }
+};
+
+#endif // SERIAL_COMMAND_H
@@ -0,0 +1,64 @@
+/*
+ * Spread registry for CIBYP-IoT-TRNG
+ * One compile-time table shared by /api/spread, /api/spreads, the serial
+ * SPREAD command and (via /api/spreads) the WebUI. Lookup hashes the type
+ * name and switches on the precomputed hashes of every registered id, so it
+ * takes constant time; colliding ids would fail to compile as duplicate cases.
+ */
+
+#ifndef SPREADS_H
+#define SPREADS_H
+
+// X(id, cardCount, name, nameEn, positionLabels...)
+#define TAROT_SPREAD_LIST(X) \
+  X(single, 1, "单牌", "Single Card", "当前指引") \
+  X(three, 3, "三张牌阵", "Three Card", "过去", "现在", "未来") \
+  X(yes_no, 1, "是非牌", "Yes or No", "回答") \
+  X(star, 5, "五芒星牌阵", "Pentagram", "当前处境", "挑战", "过去", "未来", "结果") \
+  X(horseshoe, 7, "马蹄牌阵", "Horseshoe", "过去", "现在", "隐藏影响", "障碍", "周围环境", "建议", "结果") \
+  X(hexagram, 7, "六芒星牌阵", "Hexagram", "过去", "现在", "未来", "基础", "挑战", "近期", "结果") \
+  X(celtic, 10, "凯尔特十字", "Celtic Cross", "现状", "挑战", "潜意识", "过去", "可能性", "近未来", "自我态度", "环境", "希望/恐惧", "最终结果") \
+  X(relationship, 5, "关系牌阵", "Relationship", "你", "对方", "关系基础", "挑战", "未来走向") \
+  X(zodiac, 12, "黄道十二宫", "Zodiac", "白羊", "金牛", "双子", "巨蟹", "狮子", "处女", "天秤", "天蝎", "射手", "摩羯", "水瓶", "双鱼")
+
+struct TarotSpread {
+  const char* id;
+  uint8_t count;
+  const char* name;
+  const char* nameEn;
+  const char* const* positions;  // exactly `count` labels
+};
+
+#define SPREAD_POSITIONS(id, count, name, nameEn, ...) \
+  constexpr const char* SPREAD_POSITIONS_##id[] = { __VA_ARGS__ }; \
+  static_assert(sizeof(SPREAD_POSITIONS_##id) / sizeof(SPREAD_POSITIONS_##id[0]) == count, \
+                "spread " #id ": position label count must match card count");
+TAROT_SPREAD_LIST(SPREAD_POSITIONS)
+#undef SPREAD_POSITIONS
+
+#define SPREAD_INDEX(id, ...) SPREAD_##id,
+enum TarotSpreadIndex : uint8_t { TAROT_SPREAD_LIST(SPREAD_INDEX) TAROT_SPREAD_COUNT };
+#undef SPREAD_INDEX
+
+#define SPREAD_ENTRY(id, count, name, nameEn, ...) { #id, count, name, nameEn, SPREAD_POSITIONS_##id },
+constexpr TarotSpread tarotSpreads[TAROT_SPREAD_COUNT] = { TAROT_SPREAD_LIST(SPREAD_ENTRY) };
+#undef SPREAD_ENTRY
+
+// FNV-1a, usable both at compile time (case labels) and at run time
+constexpr uint32_t spreadHash(const char* s, uint32_t h = 2166136261u) {
+  return *s ? spreadHash(s + 1, (h ^ (uint8_t)*s) * 16777619u) : h;
+}
+
+// Registered spread for a type name; unknown names fall back to a single card
+inline const TarotSpread& findSpread(const char* type) {
+  const TarotSpread* match;
+  switch (spreadHash(type)) {
+#define SPREAD_CASE(id, ...) case spreadHash(#id): match = &tarotSpreads[SPREAD_##id]; break;
+    TAROT_SPREAD_LIST(SPREAD_CASE)
+#undef SPREAD_CASE
+    default: return tarotSpreads[SPREAD_single];
+  }
+  return strcmp(match->id, type) == 0 ? *match : tarotSpreads[SPREAD_single];
+}
+
+#endif // SPREADS_H
@@ -1,95 +1,115 @@
 /*
  * Tarot Card Data - 78 cards (22 Major Arcana + 56 Minor Arcana)
  * Auto-generated for CIBYP-IoT-TRNG ESP32 firmware
+ *
+ * The card list is an X-macro so the same data can expand into both the
+ * tarotCards[] metadata table and the precomputed JSON fragments in card_json.h.
  */
 
 #ifndef TAROT_DATA_H
 #define TAROT_DATA_H
 
+#include <stdint.h>
+
+struct TarotCard {
+  uint8_t id;
+  const char* name;
+  const char* nameEn;
+  const char* arcana; // "major" or "minor"
+  const char* meaningOfUpright;
+  const char* meaningOfReversed;
+};
+
+// X(id, name, nameEn, arcana, meaningOfUpright, meaningOfReversed)
+#define TAROT_CARD_LIST(X) \
+  /* ---- Major Arcana (0-21) ---- */ \
+  X(0, "愚者", "The Fool", "major", "新的开始、冒险、自由", "鲁莽、冲动、不计后果") \
+  X(1, "魔术师", "The Magician", "major", "创造力、技能、意志力", "欺骗、操控、才能浪费") \
+  X(2, "女祭司", "The High Priestess", "major", "直觉、潜意识、神秘", "隐秘、脱节、表面化") \
+  X(3, "女皇", "The Empress", "major", "丰饶、母性、自然", "依赖、空虚、创意枯竭") \
+  X(4, "皇帝", "The Emperor", "major", "权威、结构、领导力", "专制、僵化、控制欲") \
+  X(5, "教皇", "The Hierophant", "major", "传统、信仰、指导", "叛逆、打破常规、教条") \
+  X(6, "恋人", "The Lovers", "major", "爱情、和谐、选择", "失衡、分离、价值观冲突") \
+  X(7, "战车", "The Chariot", "major", "意志力、胜利、决心", "失控、攻击性、方向迷失") \
+  X(8, "力量", "Strength", "major", "勇气、耐心、内在力量", "自我怀疑、软弱、不安") \
+  X(9, "隐者", "The Hermit", "major", "内省、寻找真理、独处", "孤立、逃避、固执己见") \
+  X(10, "命运之轮", "Wheel of Fortune", "major", "命运、转折点、机遇", "厄运、抗拒变化、失控") \
+  X(11, "正义", "Justice", "major", "公正、真相、因果", "不公、偏见、逃避责任") \
+  X(12, "倒吊人", "The Hanged Man", "major", "牺牲、放下、新视角", "拖延、抗拒、徒劳牺牲") \
+  X(13, "死神", "Death", "major", "结束、转变、新生", "抗拒改变、停滞、恐惧") \
+  X(14, "节制", "Temperance", "major", "平衡、耐心、调和", "失衡、过度、缺乏远见") \
+  X(15, "恶魔", "The Devil", "major", "诱惑、束缚、物质主义", "解脱、觉醒、打破枷锁") \
+  X(16, "塔", "The Tower", "major", "剧变、觉醒、解放", "逃避灾难、恐惧改变") \
+  X(17, "星星", "The Star", "major", "希望、灵感、宁静", "绝望、失信、脱节") \
+  X(18, "月亮", "The Moon", "major", "幻觉、直觉、不安", "释放恐惧、真相大白") \
+  X(19, "太阳", "The Sun", "major", "成功、活力、快乐", "暂时低落、过度乐观") \
+  X(20, "审判", "Judgement", "major", "重生、反思、召唤", "自我怀疑、拒绝反省") \
+  X(21, "世界", "The World", "major", "完成、成就、旅程终点", "未完成、拖延、缺乏结局") \
+  /* ---- Minor Arcana: Wands (22-35) ---- */ \
+  X(22, "权杖王牌", "Ace of Wands", "minor", "灵感、新机遇、潜力", "延迟、缺乏动力") \
+  X(23, "权杖二", "Two of Wands", "minor", "计划、展望、决策", "恐惧未知、缺乏规划") \
+  X(24, "权杖三", "Three of Wands", "minor", "远见、拓展、等待成果", "受阻、缺乏远见") \
+  X(25, "权杖四", "Four of Wands", "minor", "庆祝、和谐、里程碑", "不稳定、过渡期") \
+  X(26, "权杖五", "Five of Wands", "minor", "竞争、冲突、挑战", "逃避冲突、内心矛盾") \
+  X(27, "权杖六", "Six of Wands", "minor", "胜利、认可、成就", "失败、缺乏信心") \
+  X(28, "权杖七", "Seven of Wands", "minor", "防御、坚持、挑战", "屈服、不堪重负") \
+  X(29, "权杖八", "Eight of Wands", "minor", "快速行动、进展、消息", "延迟、受阻、混乱") \
+  X(30, "权杖九", "Nine of Wands", "minor", "坚韧、毅力、考验", "疲惫、放弃、偏执") \
+  X(31, "权杖十", "Ten of Wands", "minor", "重担、责任、压力", "逃避责任、精疲力竭") \
+  X(32, "权杖侍从", "Page of Wands", "minor", "热情、探索、新消息", "鲁莽、缺乏方向") \
+  X(33, "权杖骑士", "Knight of Wands", "minor", "冒险、热情、行动", "冲动、鲁莽、半途而废") \
+  X(34, "权杖王后", "Queen of Wands", "minor", "自信、决断、温暖", "自私、嫉妒、报复") \
+  X(35, "权杖国王", "King of Wands", "minor", "领导力、远见、成熟", "专横、独断、高期望") \
+  /* ---- Minor Arcana: Cups (36-49) ---- */ \
+  X(36, "圣杯王牌", "Ace of Cups", "minor", "新感情、直觉、创意", "感情压抑、空虚") \
+  X(37, "圣杯二", "Two of Cups", "minor", "伙伴关系、相互吸引、合作", "失衡、分离、误解") \
+  X(38, "圣杯三", "Three of Cups", "minor", "友谊、庆祝、创意", "过度放纵、孤立") \
+  X(39, "圣杯四", "Four of Cups", "minor", "沉思、不满、冷漠", "动力恢复、新意识") \
+  X(40, "圣杯五", "Five of Cups", "minor", "失落、悲伤、遗憾", "接受、前进、原谅") \
+  X(41, "圣杯六", "Six of Cups", "minor", "怀旧、童真、善意", "活在当下、放下过去") \
+  X(42, "圣杯七", "Seven of Cups", "minor", "幻想、选择、白日梦", "诱惑、困惑、逃避现实") \
+  X(43, "圣杯八", "Eight of Cups", "minor", "放弃、寻求真相、前进", "逃避、恐惧改变") \
+  X(44, "圣杯九", "Nine of Cups", "minor", "满足、幸福、愿望实现", "不满、贪婪、虚荣") \
+  X(45, "圣杯十", "Ten of Cups", "minor", "家庭美满、和谐、圆满", "家庭冲突、不和谐") \
+  X(46, "圣杯侍从", "Page of Cups", "minor", "创意、直觉、新感情", "情绪不稳、不成熟") \
+  X(47, "圣杯骑士", "Knight of Cups", "minor", "浪漫、魅力、理想主义", "情感欺骗、不现实") \
+  X(48, "圣杯王后", "Queen of Cups", "minor", "同情、直觉、情感成熟", "情感依赖、不安全") \
+  X(49, "圣杯国王", "King of Cups", "minor", "情感平衡、慷慨、外交", "情感操控、压抑") \
+  /* ---- Minor Arcana: Swords (50-63) ---- */ \
+  X(50, "宝剑王牌", "Ace of Swords", "minor", "清晰、真相、突破", "混乱、误解、暴力") \
+  X(51, "宝剑二", "Two of Swords", "minor", "抉择、僵局、回避", "信息过载、犹豫不决") \
+  X(52, "宝剑三", "Three of Swords", "minor", "心碎、悲痛、分离", "恢复、原谅、释放痛苦") \
+  X(53, "宝剑四", "Four of Swords", "minor", "休息、恢复、冥想", "疲劳、倦怠、不安") \
+  X(54, "宝剑五", "Five of Swords", "minor", "冲突、失败、欺骗", "和解、原谅、放下") \
+  X(55, "宝剑六", "Six of Swords", "minor", "过渡、离开、前进", "困在过去、抗拒改变") \
+  X(56, "宝剑七", "Seven of Swords", "minor", "策略、隐秘、独立", "欺骗暴露、自我欺骗") \
+  X(57, "宝剑八", "Eight of Swords", "minor", "受困、限制、无力感", "自我解放、新观点") \
+  X(58, "宝剑九", "Nine of Swords", "minor", "焦虑、噩梦、绝望", "恢复希望、面对恐惧") \
+  X(59, "宝剑十", "Ten of Swords", "minor", "终结、痛苦、失败", "恢复、浴火重生") \
+  X(60, "宝剑侍从", "Page of Swords", "minor", "好奇、机敏、新想法", "八卦、草率、缺乏计划") \
+  X(61, "宝剑骑士", "Knight of Swords", "minor", "果断、雄心、冲锋", "鲁莽、无情、仓促") \
+  X(62, "宝剑王后", "Queen of Swords", "minor", "独立、清晰、直率", "冷漠、苛刻、偏见") \
+  X(63, "宝剑国王", "King of Swords", "minor", "权威、理性、公正", "冷酷、独裁、暴君") \
+  /* ---- Minor Arcana: Pentacles (64-77) ---- */ \
+  X(64, "星币王牌", "Ace of Pentacles", "minor", "新财运、机遇、繁荣", "机会错失、计划不周") \
+  X(65, "星币二", "Two of Pentacles", "minor", "平衡、灵活、优先级", "失衡、力不从心") \
+  X(66, "星币三", "Three of Pentacles", "minor", "团队合作、技能、学习", "缺乏合作、平庸") \
+  X(67, "星币四", "Four of Pentacles", "minor", "安全感、控制、节俭", "贪婪、吝啬、过度控制") \
+  X(68, "星币五", "Five of Pentacles", "minor", "困难、贫困、孤立", "恢复、重新站起来") \
+  X(69, "星币六", "Six of Pentacles", "minor", "慷慨、施与受、平衡", "权力不平等、自私") \
+  X(70, "星币七", "Seven of Pentacles", "minor", "耐心、投资、等待收获", "缺乏远见、急于求成") \
+  X(71, "星币八", "Eight of Pentacles", "minor", "勤奋、技艺、专注", "完美主义、缺乏动力") \
+  X(72, "星币九", "Nine of Pentacles", "minor", "独立、富足、自律", "过度依赖、缺乏自律") \
+  X(73, "星币十", "Ten of Pentacles", "minor", "财富、传承、家族", "财务纠纷、短期思维") \
+  X(74, "星币侍从", "Page of Pentacles", "minor", "学习、务实、新技能", "缺乏进步、短视") \
+  X(75, "星币骑士", "Knight of Pentacles", "minor", "稳定、勤劳、耐心", "无聊、停滞、懒惰") \
+  X(76, "星币王后", "Queen of Pentacles", "minor", "务实、安全感、滋养", "工作生活失衡、不安全") \
+  X(77, "星币国王", "King of Pentacles", "minor", "财富、安全、领导力", "贪婪、物质主义、固执")
+
 const TarotCard tarotCards[78] = {
-  // ---- Major Arcana (0-21) ----
-  {0, "愚者", "The Fool", "major", "新的开始、冒险、自由", "鲁莽、冲动、不计后果"},
-  {1, "魔术师", "The Magician", "major", "创造力、技能、意志力", "欺骗、操控、才能浪费"},
-  {2, "女祭司", "The High Priestess", "major", "直觉、潜意识、神秘", "隐秘、脱节、表面化"},
-  {3, "女皇", "The Empress", "major", "丰饶、母性、自然", "依赖、空虚、创意枯竭"},
-  {4, "皇帝", "The Emperor", "major", "权威、结构、领导力", "专制、僵化、控制欲"},
-  {5, "教皇", "The Hierophant", "major", "传统、信仰、指导", "叛逆、打破常规、教条"},
-  {6, "恋人", "The Lovers", "major", "爱情、和谐、选择", "失衡、分离、价值观冲突"},
-  {7, "战车", "The Chariot", "major", "意志力、胜利、决心", "失控、攻击性、方向迷失"},
-  {8, "力量", "Strength", "major", "勇气、耐心、内在力量", "自我怀疑、软弱、不安"},
-  {9, "隐者", "The Hermit", "major", "内省、寻找真理、独处", "孤立、逃避、固执己见"},
-  {10, "命运之轮", "Wheel of Fortune", "major", "命运、转折点、机遇", "厄运、抗拒变化、失控"},
-  {11, "正义", "Justice", "major", "公正、真相、因果", "不公、偏见、逃避责任"},
-  {12, "倒吊人", "The Hanged Man", "major", "牺牲、放下、新视角", "拖延、抗拒、徒劳牺牲"},
-  {13, "死神", "Death", "major", "结束、转变、新生", "抗拒改变、停滞、恐惧"},
-  {14, "节制", "Temperance", "major", "平衡、耐心、调和", "失衡、过度、缺乏远见"},
-  {15, "恶魔", "The Devil", "major", "诱惑、束缚、物质主义", "解脱、觉醒、打破枷锁"},
-  {16, "塔", "The Tower", "major", "剧变、觉醒、解放", "逃避灾难、恐惧改变"},
-  {17, "星星", "The Star", "major", "希望、灵感、宁静", "绝望、失信、脱节"},
-  {18, "月亮", "The Moon", "major", "幻觉、直觉、不安", "释放恐惧、真相大白"},
-  {19, "太阳", "The Sun", "major", "成功、活力、快乐", "暂时低落、过度乐观"},
-  {20, "审判", "Judgement", "major", "重生、反思、召唤", "自我怀疑、拒绝反省"},
-  {21, "世界", "The World", "major", "完成、成就、旅程终点", "未完成、拖延、缺乏结局"},
-  // ---- Minor Arcana: Wands (22-35) ----
-  {22, "权杖王牌", "Ace of Wands", "minor", "灵感、新机遇、潜力", "延迟、缺乏动力"},
-  {23, "权杖二", "Two of Wands", "minor", "计划、展望、决策", "恐惧未知、缺乏规划"},
-  {24, "权杖三", "Three of Wands", "minor", "远见、拓展、等待成果", "受阻、缺乏远见"},
-  {25, "权杖四", "Four of Wands", "minor", "庆祝、和谐、里程碑", "不稳定、过渡期"},
-  {26, "权杖五", "Five of Wands", "minor", "竞争、冲突、挑战", "逃避冲突、内心矛盾"},
-  {27, "权杖六", "Six of Wands", "minor", "胜利、认可、成就", "失败、缺乏信心"},
-  {28, "权杖七", "Seven of Wands", "minor", "防御、坚持、挑战", "屈服、不堪重负"},
-  {29, "权杖八", "Eight of Wands", "minor", "快速行动、进展、消息", "延迟、受阻、混乱"},
-  {30, "权杖九", "Nine of Wands", "minor", "坚韧、毅力、考验", "疲惫、放弃、偏执"},
-  {31, "权杖十", "Ten of Wands", "minor", "重担、责任、压力", "逃避责任、精疲力竭"},
-  {32, "权杖侍从", "Page of Wands", "minor", "热情、探索、新消息", "鲁莽、缺乏方向"},
-  {33, "权杖骑士", "Knight of Wands", "minor", "冒险、热情、行动", "冲动、鲁莽、半途而废"},
-  {34, "权杖王后", "Queen of Wands", "minor", "自信、决断、温暖", "自私、嫉妒、报复"},
-  {35, "权杖国王", "King of Wands", "minor", "领导力、远见、成熟", "专横、独断、高期望"},
-  // ---- Minor Arcana: Cups (36-49) ----
-  {36, "圣杯王牌", "Ace of Cups", "minor", "新感情、直觉、创意", "感情压抑、空虚"},
-  {37, "圣杯二", "Two of Cups", "minor", "伙伴关系、相互吸引、合作", "失衡、分离、误解"},
-  {38, "圣杯三", "Three of Cups", "minor", "友谊、庆祝、创意", "过度放纵、孤立"},
-  {39, "圣杯四", "Four of Cups", "minor", "沉思、不满、冷漠", "动力恢复、新意识"},
-  {40, "圣杯五", "Five of Cups", "minor", "失落、悲伤、遗憾", "接受、前进、原谅"},
-  {41, "圣杯六", "Six of Cups", "minor", "怀旧、童真、善意", "活在当下、放下过去"},
-  {42, "圣杯七", "Seven of Cups", "minor", "幻想、选择、白日梦", "诱惑、困惑、逃避现实"},
-  {43, "圣杯八", "Eight of Cups", "minor", "放弃、寻求真相、前进", "逃避、恐惧改变"},
-  {44, "圣杯九", "Nine of Cups", "minor", "满足、幸福、愿望实现", "不满、贪婪、虚荣"},
-  {45, "圣杯十", "Ten of Cups", "minor", "家庭美满、和谐、圆满", "家庭冲突、不和谐"},
-  {46, "圣杯侍从", "Page of Cups", "minor", "创意、直觉、新感情", "情绪不稳、不成熟"},
-  {47, "圣杯骑士", "Knight of Cups", "minor", "浪漫、魅力、理想主义", "情感欺骗、不现实"},
-  {48, "圣杯王后", "Queen of Cups", "minor", "同情、直觉、情感成熟", "情感依赖、不安全"},
-  {49, "圣杯国王", "King of Cups", "minor", "情感平衡、慷慨、外交", "情感操控、压抑"},
-  // ---- Minor Arcana: Swords (50-63) ----
-  {50, "宝剑王牌", "Ace of Swords", "minor", "清晰、真相、突破", "混乱、误解、暴力"},
-  {51, "宝剑二", "Two of Swords", "minor", "抉择、僵局、回避", "信息过载、犹豫不决"},
-  {52, "宝剑三", "Three of Swords", "minor", "心碎、悲痛、分离", "恢复、原谅、释放痛苦"},
-  {53, "宝剑四", "Four of Swords", "minor", "休息、恢复、冥想", "疲劳、倦怠、不安"},
-  {54, "宝剑五", "Five of Swords", "minor", "冲突、失败、欺骗", "和解、原谅、放下"},
-  {55, "宝剑六", "Six of Swords", "minor", "过渡、离开、前进", "困在过去、抗拒改变"},
-  {56, "宝剑七", "Seven of Swords", "minor", "策略、隐秘、独立", "欺骗暴露、自我欺骗"},
-  {57, "宝剑八", "Eight of Swords", "minor", "受困、限制、无力感", "自我解放、新观点"},
-  {58, "宝剑九", "Nine of Swords", "minor", "焦虑、噩梦、绝望", "恢复希望、面对恐惧"},
-  {59, "宝剑十", "Ten of Swords", "minor", "终结、痛苦、失败", "恢复、浴火重生"},
-  {60, "宝剑侍从", "Page of Swords", "minor", "好奇、机敏、新想法", "八卦、草率、缺乏计划"},
-  {61, "宝剑骑士", "Knight of Swords", "minor", "果断、雄心、冲锋", "鲁莽、无情、仓促"},
-  {62, "宝剑王后", "Queen of Swords", "minor", "独立、清晰、直率", "冷漠、苛刻、偏见"},
-  {63, "宝剑国王", "King of Swords", "minor", "权威、理性、公正", "冷酷、独裁、暴君"},
-  // ---- Minor Arcana: Pentacles (64-77) ----
-  {64, "星币王牌", "Ace of Pentacles", "minor", "新财运、机遇、繁荣", "机会错失、计划不周"},
-  {65, "星币二", "Two of Pentacles", "minor", "平衡、灵活、优先级", "失衡、力不从心"},
-  {66, "星币三", "Three of Pentacles", "minor", "团队合作、技能、学习", "缺乏合作、平庸"},
-  {67, "星币四", "Four of Pentacles", "minor", "安全感、控制、节俭", "贪婪、吝啬、过度控制"},
-  {68, "星币五", "Five of Pentacles", "minor", "困难、贫困、孤立", "恢复、重新站起来"},
-  {69, "星币六", "Six of Pentacles", "minor", "慷慨、施与受、平衡", "权力不平等、自私"},
-  {70, "星币七", "Seven of Pentacles", "minor", "耐心、投资、等待收获", "缺乏远见、急于求成"},
-  {71, "星币八", "Eight of Pentacles", "minor", "勤奋、技艺、专注", "完美主义、缺乏动力"},
-  {72, "星币九", "Nine of Pentacles", "minor", "独立、富足、自律", "过度依赖、缺乏自律"},
-  {73, "星币十", "Ten of Pentacles", "minor", "财富、传承、家族", "财务纠纷、短期思维"},
-  {74, "星币侍从", "Page of Pentacles", "minor", "学习、务实、新技能", "缺乏进步、短视"},
-  {75, "星币骑士", "Knight of Pentacles", "minor", "稳定、勤劳、耐心", "无聊、停滞、懒惰"},
-  {76, "星币王后", "Queen of Pentacles", "minor", "务实、安全感、滋养", "工作生活失衡、不安全"},
-  {77, "星币国王", "King of Pentacles", "minor", "财富、安全、领导力", "贪婪、物质主义、固执"}
+#define TAROT_CARD_ENTRY(id, name, nameEn, arcana, up, rev) {id, name, nameEn, arcana, up, rev},
+  TAROT_CARD_LIST(TAROT_CARD_ENTRY)
+#undef TAROT_CARD_ENTRY
 };
 
 const int TAROT_CARD_COUNT = 78;
@@ -1,13 +1,13 @@
 /*
  * WebUI HTML for CIBYP-IoT-TRNG
  * Beautiful responsive single-page interface
+ * After editing, regenerate web_ui_gz.h with: npm run build-trng-webui
  */
 
 #ifndef WEB_UI_H
 #define WEB_UI_H
 
-String getWebUIHTML() {
-  return R"rawliteral(
+const char WEB_UI_HTML[] PROGMEM = R"rawliteral(
 <!DOCTYPE html>
 <html lang="zh-CN">
 <head>
@@ -245,17 +245,7 @@ String getWebUIHTML() {
     <div class="panel active" data-tab="draw">
       <div class="card">
         <h3>选择牌阵</h3>
-        <div class="spread-grid">
-          <div class="spread-btn active" data-type="single">单牌<small>1张</small></div>
-          <div class="spread-btn" data-type="three">三张牌阵<small>过去/现在/未来</small></div>
-          <div class="spread-btn" data-type="yes_no">是非牌<small>1张</small></div>
-          <div class="spread-btn" data-type="star">五芒星<small>5张</small></div>
-          <div class="spread-btn" data-type="horseshoe">马蹄牌阵<small>7张</small></div>
-          <div class="spread-btn" data-type="hexagram">六芒星<small>7张</small></div>
-          <div class="spread-btn" data-type="celtic">凯尔特十字<small>10张</small></div>
-          <div class="spread-btn" data-type="relationship">关系牌阵<small>5张</small></div>
-          <div class="spread-btn" data-type="zodiac">黄道十二宫<small>12张</small></div>
-        </div>
+        <div class="spread-grid" id="spread-grid"></div>
         <button class="draw-btn" id="btn-draw" onclick="doDraw()">抽牌</button>
       </div>
       <div class="results" id="results"></div>
@@ -311,28 +301,35 @@ String getWebUIHTML() {
       });
     });
 
-    // Spread selection
+    // Spread selection: names, card counts and position labels come from the
+    // firmware's spread registry (/api/spreads, revalidated by ETag)
     let selectedSpread = 'single';
-    document.querySelectorAll('.spread-btn').forEach(b => {
-      b.addEventListener('click', () => {
-        document.querySelectorAll('.spread-btn').forEach(x => x.classList.remove('active'));
-        b.classList.add('active');
-        selectedSpread = b.dataset.type;
-      });
-    });
+    let spreads = {};
 
-    // Position labels for spreads
-    const posLabels = {
-      single: ['当前指引'],
-      yes_no: ['回答'],
-      three: ['过去', '现在', '未来'],
-      star: ['当前处境', '挑战', '过去', '未来', '结果'],
-      horseshoe: ['过去', '现在', '隐藏影响', '障碍', '周围环境', '建议', '结果'],
-      hexagram: ['过去', '现在', '未来', '基础', '挑战', '近期', '结果'],
-      celtic: ['现状', '挑战', '潜意识', '过去', '可能性', '近未来', '自我态度', '环境', '希望/恐惧', '最终结果'],
-      relationship: ['你', '对方', '关系基础', '挑战', '未来走向'],
-      zodiac: ['白羊', '金牛', '双子', '巨蟹', '狮子', '处女', '天秤', '天蝎', '射手', '摩羯', '水瓶', '双鱼']
-    };
+    async function loadSpreads() {
+      try {
+        const res = await fetch('/api/spreads');
+        const data = await res.json();
+        const grid = document.getElementById('spread-grid');
+        grid.innerHTML = '';
+        data.spreads.forEach(sp => {
+          spreads[sp.id] = sp;
+          const b = document.createElement('div');
+          b.className = 'spread-btn' + (sp.id === selectedSpread ? ' active' : '');
+          b.dataset.type = sp.id;
+          b.innerHTML = sp.name + '<small>' + sp.count + '张' + '</small>';
+          b.addEventListener('click', () => {
+            grid.querySelectorAll('.spread-btn').forEach(x => x.classList.remove('active'));
+            b.classList.add('active');
+            selectedSpread = sp.id;
+          });
+          grid.appendChild(b);
+        });
+      } catch(e) {
+        document.getElementById('spread-grid').innerHTML = '<div class="status-msg error">牌阵加载失败: '+e.message+'</div>';
+      }
+    }
+    loadSpreads();
 
     async function doDraw() {
       const btn = document.getElementById('btn-draw');
@@ -351,7 +348,7 @@ String getWebUIHTML() {
 
     function renderResults(data) {
       const el = document.getElementById('results');
-      const labels = posLabels[selectedSpread] || [];
+      const labels = (spreads[selectedSpread] || {}).positions || [];
       let html = '<div class="entropy-badge">TRNG 硬件真随机</div>';
       html += '<h3 style="margin-bottom:16px">' + (data.spread||'抽牌结果') + '</h3>';
       data.cards.forEach((c, i) => {
@@ -486,6 +483,5 @@ String getWebUIHTML() {
 </body>
 </html>
 )rawliteral";
-}
 
 #endif // WEB_UI_H
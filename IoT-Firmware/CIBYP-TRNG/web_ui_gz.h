@@ -0,0 +1,359 @@
+/*
+ * Gzip-compressed WebUI for CIBYP-IoT-TRNG
+ * Auto-generated by scripts/build-trng-webui.js from web_ui.h - do not edit
+ * 18517 bytes -> 5458 bytes gzip
+ */
+
+#ifndef WEB_UI_GZ_H
+#define WEB_UI_GZ_H
+
+#define WEB_UI_ETAG "\"190070ad7a9371c0\""
+#define WEB_UI_ETAG_GZIP "\"190070ad7a9371c0-gz\""
+
+const size_t WEB_UI_GZ_LEN = 5458;
+const uint8_t WEB_UI_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x5c, 0xeb, 0x77, 0x13, 0x47,
+  0x96, 0xff, 0xce, 0x5f, 0x51, 0x11, 0x27, 0xdb, 0xd2, 0x58, 0xdd, 0x92, 0x2c, 0xdb, 0xb1, 0x65,
+  0x49, 0x0c, 0xe1, 0x31, 0x30, 0x1b, 0x02, 0x07, 0x9c, 0xb3, 0x9b, 0xc3, 0xe1, 0x43, 0x49, 0x5d,
+  0x92, 0x3a, 0xb4, 0xba, 0x3b, 0xd5, 0x25, 0x3f, 0x30, 0x9c, 0x03, 0x84, 0xf0, 0x26, 0x90, 0x4d,
+  0xc2, 0x30, 0x04, 0xb2, 0x10, 0x98, 0x4d, 0x72, 0x26, 0x06, 0x72, 0x36, 0x93, 0x10, 0x83, 0xc3,
+  0x1f, 0x13, 0xb5, 0x64, 0x7f, 0xca, 0xbf, 0xb0, 0xa7, 0xaa, 0xfa, 0x51, 0xfd, 0xd0, 0xc3, 0xcc,
+  0x2c, 0x1f, 0x8c, 0x54, 0x8f, 0x5b, 0xb7, 0xee, 0xfd, 0xd5, 0x7d, 0xd4, 0x2d, 0x7b, 0x47, 0xf9,
+  0x8d, 0xbd, 0x87, 0xf7, 0x2c, 0xbc, 0x7f, 0x64, 0x1f, 0x68, 0x91, 0xb6, 0x5e, 0xdd, 0x51, 0xa6,
+  0xff, 0x01, 0x1d, 0x1a, 0xcd, 0x4a, 0xea, 0x54, 0x4b, 0xde, 0xf3, 0x6e, 0x8a, 0xb6, 0x21, 0xa8,
+  0x56, 0x77, 0x00, 0x50, 0x6e, 0x23, 0x02, 0x41, 0xbd, 0x05, 0xb1, 0x8d, 0x48, 0x25, 0xf5, 0xde,
+  0xc2, 0x7e, 0x79, 0x36, 0x15, 0x74, 0x18, 0xb0, 0x8d, 0x2a, 0xa9, 0x45, 0x0d, 0x2d, 0x59, 0x26,
+  0x26, 0x29, 0x50, 0x37, 0x0d, 0x82, 0x0c, 0x52, 0x49, 0x2d, 0x69, 0x2a, 0x69, 0x55, 0x54, 0xb4,
+  0xa8, 0xd5, 0x91, 0xcc, 0xbe, 0x64, 0x81, 0x66, 0x68, 0x44, 0x83, 0xba, 0x6c, 0xd7, 0xa1, 0x8e,
+  0x2a, 0x05, 0x25, 0xcf, 0x09, 0x11, 0x8d, 0xe8, 0xa8, 0xba, 0xe7, 0xe0, 0xdb, 0xef, 0x1f, 0x01,
+  0x07, 0xcd, 0x05, 0xb0, 0x70, 0xf4, 0xdd, 0x3f, 0x95, 0x73, 0xbc, 0x95, 0xf6, 0xdb, 0x64, 0x85,
+  0x7f, 0x02, 0xa0, 0x84, 0x4d, 0x93, 0x80, 0x55, 0xf6, 0x19, 0x00, 0x59, 0x86, 0xf5, 0x3a, 0x32,
+  0x48, 0x09, 0xec, 0x6c, 0xbc, 0x55, 0x7f, 0xab, 0x58, 0x98, 0x8f, 0x74, 0xc8, 0x2a, 0xc4, 0x27,
+  0x4b, 0x60, 0xa7, 0x3a, 0x05, 0x67, 0xf3, 0xf9, 0xa0, 0xb7, 0xd6, 0x2c, 0x81, 0x9d, 0xf9, 0x46,
+  0xbe, 0x51, 0x80, 0x62, 0xe3, 0x64, 0x09, 0xec, 0x2c, 0xc0, 0x02, 0x9c, 0x44, 0x62, 0x6b, 0xb1,
+  0x04, 0x76, 0x4e, 0x4e, 0x4f, 0x4e, 0x4f, 0x09, 0x04, 0x08, 0x5a, 0xa6, 0xab, 0xa2, 0x59, 0x34,
+  0xdb, 0x88, 0x34, 0x53, 0x22, 0x73, 0x73, 0x73, 0x73, 0xb5, 0x9a, 0x40, 0xc4, 0xc4, 0x2a, 0xc2,
+  0x25, 0xb0, 0xb3, 0x58, 0x2c, 0x16, 0xa7, 0xa7, 0x83, 0x0e, 0xbb, 0x53, 0xaf, 0x23, 0xdb, 0xa6,
+  0x2b, 0xe4, 0x6b, 0x8d, 0x19, 0x61, 0x8a, 0x0a, 0x8d, 0x26, 0x9b, 0x82, 0x6a, 0xc5, 0xda, 0xb4,
+  0xc0, 0x26, 0x86, 0xaa, 0xd6, 0xb1, 0x4b, 0xa0, 0x30, 0x69, 0x2d, 0xf3, 0xd6, 0x33, 0xec, 0xe7,
+  0x1f, 0xc0, 0x2a, 0x68, 0x43, 0xdc, 0xd4, 0x8c, 0x12, 0xc8, 0xcf, 0x03, 0x0b, 0xaa, 0xaa, 0x66,
+  0x34, 0xd9, 0xe7, 0x9a, 0xb9, 0x2c, 0xdb, 0xda, 0x29, 0xf6, 0x95, 0xb3, 0x22, 0xd7, 0xcc, 0xe5,
+  0x79, 0x77, 0x62, 0xcd, 0x54, 0x57, 0x7c, 0x91, 0x36, 0x4c, 0x83, 0xc8, 0x0d, 0xd8, 0xd6, 0xf4,
+  0x95, 0x12, 0x90, 0xa1, 0x65, 0xe9, 0x48, 0xb6, 0x57, 0x6c, 0x82, 0xda, 0x59, 0xf0, 0xb6, 0xae,
+  0x19, 0x27, 0x0f, 0xc1, 0xfa, 0x31, 0xf6, 0x7d, 0xbf, 0x69, 0x90, 0x2c, 0x90, 0x8e, 0xa1, 0xa6,
+  0x89, 0xc0, 0x7b, 0x07, 0xa5, 0x2c, 0xe0, 0xe3, 0xe4, 0x8e, 0x96, 0x05, 0x36, 0x34, 0x6c, 0xd9,
+  0x46, 0x58, 0x6b, 0x78, 0x8c, 0xd7, 0x60, 0xfd, 0x64, 0x13, 0x9b, 0x1d, 0x43, 0x2d, 0x81, 0x45,
+  0x88, 0xd3, 0x54, 0xb2, 0x19, 0xaf, 0xb3, 0x6e, 0xea, 0x26, 0xf6, 0xda, 0xa9, 0x10, 0xfd, 0x9e,
+  0xb6, 0x66, 0xc8, 0x2d, 0xa4, 0x35, 0x5b, 0xa4, 0x04, 0x0a, 0xf9, 0xfc, 0x62, 0x4b, 0xdc, 0xb2,
+  0x42, 0x41, 0x8a, 0xb0, 0xcf, 0xbc, 0xb8, 0x86, 0xae, 0x19, 0x08, 0x62, 0xb9, 0x49, 0xc5, 0x85,
+  0x0c, 0x92, 0x2e, 0x14, 0xa7, 0x55, 0xd4, 0xcc, 0xfa, 0x6b, 0x4f, 0x66, 0x40, 0xfe, 0xcd, 0xe0,
+  0x6b, 0x31, 0x43, 0xc9, 0xbf, 0xe9, 0xaf, 0xeb, 0x8b, 0x89, 0x10, 0xb3, 0x5d, 0x02, 0x93, 0xd6,
+  0x32, 0xb0, 0x4d, 0x5d, 0x53, 0xdd, 0x09, 0x1c, 0x5e, 0xfe, 0x68, 0x5f, 0xd8, 0x85, 0x19, 0x6b,
+  0x19, 0x4c, 0x4e, 0x79, 0x9a, 0x01, 0x40, 0xd5, 0x6c, 0x4b, 0x87, 0x2b, 0x25, 0xd0, 0xd0, 0x91,
+  0xdf, 0x08, 0x75, 0xad, 0x69, 0xc8, 0x1a, 0x41, 0x6d, 0xbb, 0x04, 0x28, 0x21, 0x84, 0xbd, 0xae,
+  0x0f, 0x3a, 0x36, 0xd1, 0x1a, 0x2b, 0xb2, 0x7b, 0x8e, 0x4a, 0xc0, 0xb6, 0x60, 0x1d, 0xc9, 0x35,
+  0x44, 0x96, 0x10, 0x32, 0x92, 0x36, 0xdf, 0x2a, 0x84, 0x95, 0x67, 0x6b, 0xa7, 0x50, 0x09, 0x4c,
+  0xe6, 0x03, 0x1e, 0xc6, 0x17, 0x8b, 0xbb, 0xad, 0x2c, 0xd8, 0xd9, 0x68, 0xa0, 0xfc, 0x2c, 0xf4,
+  0x37, 0x28, 0x2f, 0xa1, 0xda, 0x49, 0x8d, 0xc8, 0x01, 0x29, 0xb9, 0xae, 0x6b, 0x56, 0x09, 0x50,
+  0x65, 0x45, 0x07, 0xd1, 0x36, 0xb9, 0xa1, 0xe9, 0xba, 0xec, 0xea, 0x95, 0x60, 0x68, 0xd8, 0x16,
+  0xc4, 0xc8, 0xf0, 0xc7, 0xea, 0x88, 0x10, 0x84, 0x65, 0xba, 0x3b, 0x2e, 0xb8, 0x30, 0x98, 0xbd,
+  0xcd, 0x29, 0xf5, 0x96, 0x66, 0xc9, 0x9a, 0xd1, 0x30, 0x93, 0x36, 0x59, 0x28, 0x04, 0x9b, 0x8c,
+  0x41, 0x68, 0x32, 0x33, 0x16, 0xf4, 0x7c, 0xd5, 0x4d, 0x59, 0xcb, 0xa0, 0x20, 0x4a, 0x8d, 0x23,
+  0xc0, 0x3b, 0x6e, 0x81, 0x40, 0x5d, 0x0e, 0x09, 0xac, 0xd9, 0x3e, 0x53, 0x89, 0x6a, 0x4e, 0x5a,
+  0x77, 0x72, 0x10, 0xc2, 0x0a, 0x11, 0x84, 0xf1, 0x6e, 0x7f, 0xb4, 0xb9, 0x88, 0x70, 0x43, 0x37,
+  0x97, 0xe4, 0xe5, 0x12, 0x80, 0x1d, 0x62, 0x46, 0x59, 0xf1, 0x39, 0x09, 0xa0, 0x48, 0x31, 0x2b,
+  0xc2, 0xa0, 0xde, 0xc1, 0x36, 0x15, 0x91, 0x65, 0x6a, 0x22, 0xe2, 0x86, 0x08, 0x4e, 0x14, 0x75,
+  0x31, 0x20, 0xc4, 0x9a, 0x97, 0xdc, 0x43, 0x39, 0x13, 0xd8, 0xd5, 0x81, 0x67, 0x26, 0x41, 0xff,
+  0x4b, 0x2d, 0x8d, 0x20, 0xa6, 0x7e, 0x54, 0x02, 0x86, 0xb9, 0x84, 0xa1, 0xe5, 0x75, 0xb1, 0xd1,
+  0x1a, 0xd1, 0x4c, 0xa3, 0x04, 0xa0, 0xae, 0x83, 0xbc, 0x32, 0x69, 0x47, 0xb7, 0xab, 0xc0, 0x3a,
+  0xd1, 0x16, 0x11, 0x58, 0x0d, 0xb3, 0xef, 0x1d, 0x4b, 0x8f, 0x95, 0xe4, 0xce, 0x80, 0x4c, 0xa9,
+  0x45, 0xe5, 0x1a, 0xa5, 0xc2, 0x0d, 0x50, 0xa2, 0xfa, 0x8a, 0xc1, 0x74, 0xf7, 0x84, 0x82, 0xd5,
+  0x40, 0xe4, 0x4c, 0xda, 0xa0, 0x0d, 0x97, 0xb9, 0xc3, 0x2b, 0x81, 0xb9, 0xbc, 0xdb, 0xe2, 0x9a,
+  0x65, 0xae, 0x3a, 0x8f, 0x82, 0x05, 0x0d, 0xa4, 0x83, 0xd5, 0x00, 0x3c, 0x86, 0x69, 0xa0, 0x70,
+  0x6f, 0xb0, 0x4f, 0x7f, 0x50, 0x4d, 0x37, 0xeb, 0x27, 0x03, 0x2e, 0x20, 0x56, 0x13, 0xed, 0xdf,
+  0x20, 0xc0, 0x8d, 0x44, 0x5a, 0x04, 0xf7, 0x7c, 0x0c, 0xff, 0x16, 0x3f, 0x34, 0x22, 0xbe, 0xf8,
+  0x2e, 0x03, 0x40, 0xcf, 0x44, 0x0e, 0x0c, 0x63, 0xb5, 0x55, 0xf4, 0xdd, 0x54, 0x30, 0x92, 0x7a,
+  0xb2, 0x10, 0xd8, 0xe8, 0x54, 0x6f, 0x9a, 0x6d, 0x61, 0x04, 0x55, 0xb9, 0x89, 0x35, 0x35, 0x7e,
+  0xdc, 0x68, 0xab, 0xb7, 0x3e, 0xfd, 0x2c, 0x13, 0xd4, 0xb6, 0x74, 0x48, 0x10, 0x55, 0x7d, 0xa7,
+  0x6d, 0xd8, 0x25, 0x80, 0x91, 0x85, 0x20, 0x49, 0x53, 0xc9, 0x33, 0xa3, 0x94, 0xa5, 0x3e, 0xa5,
+  0x0d, 0x97, 0xd3, 0x85, 0x99, 0xbc, 0xb5, 0x9c, 0x05, 0x85, 0x06, 0xce, 0xf8, 0x1b, 0x6b, 0x42,
+  0x4b, 0xf4, 0xac, 0xb1, 0x4d, 0xc5, 0xac, 0x80, 0xcb, 0x5d, 0x8d, 0x18, 0x09, 0x27, 0x70, 0xc6,
+  0x1a, 0x6a, 0x0b, 0x8a, 0x31, 0xd5, 0x4c, 0xfe, 0xf3, 0xaa, 0x19, 0xec, 0x4a, 0x07, 0x9c, 0x7f,
+  0x51, 0xee, 0x53, 0xa3, 0x0f, 0x39, 0x33, 0xee, 0xcc, 0x81, 0x45, 0x5d, 0xd7, 0xc8, 0x73, 0x1b,
+  0xc8, 0xca, 0x3f, 0x77, 0x43, 0xcf, 0xa9, 0x28, 0x33, 0xdc, 0xac, 0xc1, 0xf4, 0xe4, 0xd4, 0x5b,
+  0xd9, 0xc2, 0xdc, 0x5c, 0x76, 0x6a, 0x2e, 0x9b, 0x57, 0xf2, 0xb3, 0x99, 0xf9, 0x38, 0xe5, 0xe0,
+  0xc0, 0xfc, 0x13, 0xa4, 0x0b, 0xd3, 0x99, 0x79, 0x30, 0xd4, 0x76, 0x08, 0x6a, 0xb7, 0xdb, 0x74,
+  0xb3, 0xf1, 0x03, 0x1a, 0xf5, 0x53, 0x89, 0x86, 0xd6, 0xc3, 0x17, 0x31, 0x2d, 0xe6, 0x81, 0xe6,
+  0xc3, 0x72, 0x9f, 0xca, 0xe7, 0xfd, 0x25, 0x55, 0x0c, 0x97, 0x42, 0x38, 0x8b, 0x2c, 0xe8, 0x19,
+  0x56, 0x6e, 0x79, 0x68, 0x30, 0x33, 0x3f, 0x2e, 0x20, 0xc7, 0x0c, 0x0a, 0xc4, 0xaf, 0x2c, 0xb2,
+  0xce, 0xc4, 0x00, 0xcc, 0x2c, 0xd8, 0xf6, 0xd1, 0x4a, 0xa3, 0xee, 0x7c, 0x80, 0xb1, 0xa8, 0x29,
+  0x48, 0x82, 0xe4, 0x5b, 0xc1, 0xf0, 0x01, 0xc0, 0x1e, 0x18, 0x62, 0x24, 0x41, 0xb5, 0x68, 0x07,
+  0x6c, 0x2f, 0xcb, 0x76, 0x0b, 0xaa, 0xe6, 0x12, 0x35, 0xd8, 0x53, 0xae, 0x13, 0x4d, 0x40, 0x89,
+  0x77, 0x7c, 0x23, 0xfa, 0xf1, 0xb1, 0xcd, 0x16, 0x69, 0x98, 0xb8, 0xed, 0x06, 0x40, 0xd4, 0x2c,
+  0xbd, 0x9f, 0x96, 0x0b, 0xd6, 0x72, 0x66, 0x3e, 0xb2, 0x0a, 0x8d, 0x1a, 0x8b, 0xc9, 0xab, 0x4c,
+  0x67, 0x62, 0x08, 0x28, 0xf9, 0x18, 0x4f, 0x5e, 0x22, 0x1f, 0x4c, 0xc1, 0xc8, 0xee, 0xe8, 0xc4,
+  0x0e, 0x6c, 0x2e, 0x03, 0x1a, 0xf7, 0x53, 0xbe, 0x1b, 0xc4, 0x26, 0x91, 0x47, 0xfa, 0x91, 0xe2,
+  0xff, 0xab, 0x1f, 0x11, 0xd5, 0x9c, 0xe4, 0x1d, 0xbc, 0xf1, 0xa6, 0xa7, 0x35, 0x8c, 0x74, 0x48,
+  0x85, 0x10, 0x8d, 0x8f, 0x4a, 0xa0, 0xa5, 0xa9, 0x6a, 0x24, 0x52, 0x0e, 0xb6, 0x58, 0x2a, 0xd5,
+  0x50, 0xc3, 0xc4, 0xc8, 0xdf, 0xaa, 0x1f, 0x67, 0x4b, 0x52, 0x7c, 0x11, 0x58, 0xb3, 0x4d, 0xbd,
+  0x43, 0xfc, 0x45, 0x98, 0xf0, 0xf2, 0xf3, 0x40, 0x47, 0x0d, 0xc2, 0x3e, 0x60, 0x8e, 0x45, 0x1f,
+  0x89, 0x5e, 0xa6, 0x52, 0x1c, 0xef, 0x9c, 0xcd, 0xe5, 0x93, 0x8e, 0x99, 0x10, 0x2d, 0x65, 0x06,
+  0x6c, 0x43, 0xc1, 0x68, 0x11, 0x61, 0x1b, 0xc5, 0xf7, 0x33, 0xf6, 0x72, 0x3c, 0xbf, 0x1c, 0x6f,
+  0x39, 0xa0, 0xd0, 0x34, 0x3f, 0x31, 0x02, 0x9f, 0x1d, 0x7d, 0x3c, 0x23, 0xfa, 0x9c, 0x8a, 0xc5,
+  0xd1, 0xe1, 0x65, 0x64, 0x64, 0x80, 0xd5, 0xd0, 0x1a, 0x93, 0xa3, 0xac, 0xa7, 0x47, 0x7a, 0x56,
+  0x80, 0xb5, 0x89, 0xe9, 0x9e, 0x21, 0x55, 0xa4, 0x5c, 0x83, 0x6a, 0x13, 0xc5, 0xed, 0xa6, 0x66,
+  0x50, 0x09, 0xc9, 0x21, 0xf3, 0x19, 0x44, 0x36, 0xd6, 0x32, 0x98, 0x1d, 0x98, 0x0d, 0x88, 0x89,
+  0xc2, 0x80, 0x84, 0x64, 0x90, 0x03, 0x4d, 0xe0, 0x59, 0x14, 0x47, 0x8c, 0x6f, 0xa5, 0x63, 0x31,
+  0x98, 0x51, 0x97, 0x16, 0xf5, 0x5a, 0xc5, 0xc9, 0x6c, 0x61, 0xae, 0x90, 0x2d, 0xe4, 0xdf, 0xca,
+  0xe6, 0x95, 0xc9, 0xa8, 0xd3, 0x72, 0x2f, 0x17, 0x32, 0x83, 0x65, 0xe2, 0xe3, 0x28, 0x89, 0xf8,
+  0x64, 0x71, 0x3a, 0x3b, 0x3d, 0x97, 0x9d, 0xcb, 0x27, 0xd1, 0x76, 0xe1, 0xe3, 0x93, 0x6e, 0x23,
+  0x68, 0x68, 0x46, 0x33, 0xa2, 0xb9, 0xe2, 0x40, 0xcd, 0x31, 0xc9, 0xfb, 0x89, 0xbd, 0x32, 0x13,
+  0x23, 0x64, 0x13, 0x6c, 0x32, 0x7a, 0x49, 0xa1, 0x79, 0x78, 0xac, 0x62, 0xa3, 0xba, 0x69, 0xa8,
+  0x10, 0xaf, 0x80, 0x55, 0x60, 0x52, 0x73, 0x4f, 0x56, 0x4a, 0x20, 0xaf, 0xcc, 0x4e, 0x27, 0xf8,
+  0x57, 0x77, 0x2a, 0x35, 0x9a, 0x32, 0xdd, 0xae, 0x95, 0x10, 0x8f, 0xce, 0x24, 0x0f, 0xd4, 0x61,
+  0x0d, 0x8d, 0xf2, 0xf4, 0xc5, 0x71, 0xb1, 0x2a, 0xac, 0xa1, 0x19, 0x56, 0x87, 0x1c, 0x27, 0x2b,
+  0x16, 0xaa, 0xa4, 0xe8, 0xe8, 0xd4, 0x89, 0x6c, 0xa8, 0xcd, 0x82, 0xb6, 0xbd, 0x64, 0x62, 0x35,
+  0xda, 0x6e, 0x74, 0xda, 0x35, 0x84, 0x53, 0x27, 0x7c, 0x64, 0x0f, 0xf5, 0xfd, 0xd4, 0xbd, 0x88,
+  0x01, 0xde, 0xd0, 0xac, 0xf8, 0xf5, 0x6c, 0xfc, 0xec, 0x90, 0x74, 0x3c, 0x33, 0x22, 0xde, 0x34,
+  0x3b, 0x84, 0x62, 0x42, 0x0c, 0x21, 0x04, 0xe9, 0x94, 0x1a, 0x66, 0xbd, 0x63, 0x8f, 0x8a, 0xea,
+  0x5c, 0x95, 0x25, 0x07, 0xe3, 0xf9, 0x48, 0x3a, 0x3c, 0x46, 0xc8, 0x32, 0x9b, 0x7c, 0xc8, 0xc7,
+  0x48, 0x85, 0x07, 0x84, 0x24, 0x23, 0x43, 0xe4, 0x1a, 0x31, 0x64, 0x0b, 0x6b, 0x6d, 0x8e, 0xe5,
+  0xb8, 0x8a, 0xfc, 0xad, 0x46, 0x02, 0xa7, 0x84, 0xf9, 0x41, 0x8c, 0x2d, 0x50, 0x61, 0xf7, 0x3a,
+  0x33, 0x33, 0xa1, 0xf1, 0xfc, 0x28, 0x27, 0x2e, 0xe7, 0x9f, 0x72, 0x77, 0x39, 0x96, 0xb5, 0x27,
+  0x4c, 0x4e, 0x5e, 0x4b, 0x9d, 0x29, 0xe6, 0xa7, 0xc3, 0xbc, 0x89, 0x27, 0x75, 0x50, 0x7e, 0x9d,
+  0x98, 0x8b, 0x8f, 0xc0, 0x63, 0xe2, 0x1a, 0x89, 0x5c, 0x25, 0xcf, 0xb3, 0x09, 0x24, 0x1d, 0x5b,
+  0x6e, 0xdb, 0x4d, 0x31, 0x9f, 0x67, 0x56, 0x3e, 0x09, 0x14, 0x21, 0xb3, 0x12, 0x4f, 0x5f, 0x8b,
+  0x62, 0xfa, 0xea, 0x53, 0x56, 0x5c, 0x7b, 0x3c, 0xd2, 0x90, 0xc7, 0xd3, 0x8f, 0x98, 0x25, 0x17,
+  0xa8, 0x22, 0x8c, 0x4d, 0x3c, 0xca, 0x7e, 0xc7, 0x49, 0x46, 0x0d, 0x38, 0x34, 0xa0, 0xbe, 0x62,
+  0x6b, 0xd1, 0x50, 0x91, 0xdb, 0xc2, 0x70, 0x9c, 0x36, 0xc0, 0x74, 0x0c, 0x8f, 0xf8, 0xc6, 0x56,
+  0xa1, 0xcf, 0x48, 0x6b, 0x6a, 0xe0, 0xf5, 0xce, 0x10, 0xbf, 0xef, 0x4f, 0xb7, 0x92, 0x7c, 0x51,
+  0xc4, 0xed, 0xcc, 0x0e, 0xb0, 0xd5, 0xe1, 0x2c, 0xcf, 0xb3, 0xfb, 0xc3, 0x33, 0x3a, 0x9f, 0xb9,
+  0x98, 0x4d, 0x48, 0x8a, 0x80, 0x7c, 0x97, 0x4c, 0xa0, 0xac, 0x62, 0xd3, 0x0a, 0x02, 0x38, 0xe1,
+  0x2a, 0x40, 0x85, 0x76, 0x0b, 0xfd, 0x2b, 0xc2, 0xeb, 0x29, 0xc1, 0xee, 0x0d, 0x4e, 0xe0, 0x87,
+  0xdc, 0x04, 0xbe, 0xae, 0x3d, 0xf3, 0xb6, 0xc7, 0x8f, 0x62, 0x36, 0x68, 0xa0, 0xc9, 0x4c, 0x53,
+  0x1e, 0xe7, 0x16, 0x60, 0xa8, 0xa9, 0xb7, 0xb0, 0xd9, 0xc4, 0xc8, 0xb6, 0xe5, 0x1a, 0xa4, 0x84,
+  0x3c, 0xcd, 0x6e, 0x03, 0xa5, 0x0c, 0x16, 0xb1, 0xec, 0x21, 0xe1, 0x80, 0x27, 0xad, 0xa8, 0xd0,
+  0x0b, 0x25, 0x61, 0x5d, 0xe6, 0x79, 0x87, 0x99, 0x6d, 0x51, 0x60, 0xcc, 0x5b, 0xf3, 0xd4, 0xd3,
+  0xf3, 0xdc, 0x74, 0xb6, 0xbb, 0x0e, 0x32, 0x08, 0x36, 0xad, 0x95, 0x11, 0xb1, 0xeb, 0x98, 0x55,
+  0x05, 0x76, 0xad, 0x25, 0x38, 0xdb, 0x71, 0x2f, 0xbd, 0x0b, 0xdb, 0xac, 0x22, 0xb8, 0x65, 0xb8,
+  0x2c, 0xd8, 0x89, 0x66, 0x68, 0xc5, 0x2d, 0x96, 0xe7, 0x4f, 0xc1, 0xe2, 0x80, 0x3c, 0xbf, 0xb0,
+  0xed, 0x44, 0x42, 0x4c, 0x0c, 0xc3, 0xe9, 0xb4, 0x1b, 0xbb, 0x27, 0x64, 0xd3, 0x53, 0xa1, 0x14,
+  0xe7, 0x8f, 0x6d, 0xa4, 0x6a, 0x10, 0xa4, 0x85, 0x1b, 0xdb, 0x19, 0x7a, 0x63, 0x9b, 0xf1, 0xe5,
+  0x1d, 0xbe, 0x7d, 0x1c, 0x71, 0xc5, 0x38, 0xc9, 0x2f, 0x13, 0x3d, 0x15, 0x26, 0xdf, 0x11, 0x8b,
+  0x60, 0xa2, 0x3f, 0xcb, 0x39, 0xb7, 0xbc, 0x59, 0xce, 0xf1, 0x92, 0x6b, 0x99, 0xd6, 0xe3, 0x58,
+  0xdd, 0x53, 0xd5, 0x16, 0x41, 0x5d, 0x87, 0xb6, 0x5d, 0x49, 0xf1, 0x72, 0x48, 0x8a, 0x17, 0x41,
+  0xcb, 0xad, 0x42, 0xac, 0x5a, 0xda, 0x2a, 0xb8, 0x7d, 0xb6, 0x05, 0x0d, 0x6f, 0x96, 0x5f, 0x3c,
+  0x49, 0x01, 0x4d, 0x15, 0xbf, 0x56, 0xf7, 0x1d, 0x3b, 0x52, 0x9c, 0x2c, 0xe7, 0xe8, 0x60, 0xb6,
+  0x54, 0x4e, 0xd5, 0x16, 0xa3, 0x6b, 0xd2, 0x02, 0x87, 0xb7, 0x62, 0xb8, 0x19, 0xf0, 0x0b, 0x88,
+  0x14, 0x50, 0x21, 0x81, 0x32, 0x81, 0xb5, 0x4a, 0x8a, 0xde, 0x4d, 0xa4, 0xaa, 0xbd, 0xab, 0x1b,
+  0xfd, 0x2b, 0xd7, 0x7d, 0x6a, 0xb1, 0x89, 0xe2, 0x8c, 0xba, 0x69, 0x34, 0xb4, 0x66, 0xaa, 0xba,
+  0xfb, 0x08, 0xd8, 0x7c, 0xf2, 0x6b, 0x7f, 0xe3, 0xc9, 0x78, 0xd3, 0x4c, 0x02, 0x53, 0xd5, 0xc3,
+  0x0b, 0xbb, 0x41, 0xef, 0xcb, 0x1f, 0x7b, 0xb7, 0x9f, 0x8d, 0x37, 0x09, 0xd6, 0xcc, 0x0e, 0x49,
+  0x55, 0x37, 0x9f, 0xfc, 0xea, 0x3c, 0xbe, 0xd4, 0x7d, 0xf5, 0xb0, 0x77, 0xee, 0x69, 0xb0, 0xe5,
+  0xa4, 0xbd, 0xbb, 0x8a, 0xf3, 0xb6, 0xff, 0x86, 0x2c, 0x83, 0xbd, 0x18, 0x2e, 0x81, 0x05, 0x58,
+  0x03, 0xb2, 0x1c, 0x5f, 0x8f, 0x5f, 0xe5, 0x0f, 0x12, 0x8b, 0x0b, 0x87, 0xd0, 0x02, 0x10, 0xab,
+  0x7e, 0x07, 0x55, 0x69, 0xb1, 0xba, 0x75, 0xf6, 0x4a, 0xef, 0xda, 0x77, 0xfd, 0x2b, 0xd7, 0xb7,
+  0xee, 0xfc, 0xa3, 0x9c, 0x6b, 0x15, 0x85, 0x5e, 0x61, 0xa2, 0x00, 0x48, 0xae, 0x55, 0xb1, 0xa1,
+  0x2a, 0x88, 0x83, 0x4d, 0xac, 0x75, 0x08, 0x31, 0x7d, 0x3c, 0x78, 0x17, 0x48, 0x7c, 0x22, 0x0b,
+  0xdf, 0x28, 0x7f, 0xc0, 0x34, 0xea, 0xba, 0x56, 0x3f, 0x59, 0x49, 0xa9, 0x26, 0xdd, 0x65, 0x3a,
+  0x13, 0x68, 0x92, 0x13, 0xf0, 0x77, 0x20, 0x92, 0x17, 0xb9, 0x72, 0xef, 0x99, 0x38, 0x61, 0xef,
+  0x8b, 0xc8, 0x8d, 0xf8, 0x91, 0x4a, 0x73, 0x0f, 0xd3, 0xfe, 0x70, 0x79, 0x26, 0xa1, 0x65, 0x3c,
+  0x51, 0xfe, 0x87, 0xb6, 0x5f, 0x03, 0x02, 0xb0, 0x06, 0x09, 0x33, 0x48, 0xee, 0x04, 0x02, 0x00,
+  0x94, 0x99, 0xc7, 0xaf, 0x1e, 0x3b, 0x76, 0x70, 0x6f, 0x39, 0xc7, 0x3f, 0x8b, 0xbd, 0x2c, 0x23,
+  0x01, 0x42, 0xbe, 0xc6, 0x4f, 0x57, 0xa3, 0x29, 0xdb, 0x36, 0xd5, 0x8a, 0xa5, 0xc3, 0x3a, 0x6a,
+  0x99, 0xba, 0x8a, 0x70, 0x25, 0xc5, 0x0e, 0xaa, 0x7c, 0xd0, 0x5c, 0x90, 0xe9, 0x41, 0x15, 0xf9,
+  0x8c, 0xa8, 0x6a, 0x6c, 0xb6, 0x9c, 0xa7, 0x17, 0xfb, 0x0f, 0xce, 0x81, 0x74, 0xff, 0x8b, 0xbf,
+  0xf6, 0xbf, 0x5b, 0xef, 0x3e, 0x5f, 0x77, 0x5e, 0x9e, 0xed, 0x7d, 0xfe, 0x6b, 0x7f, 0xe3, 0xd3,
+  0xfe, 0x8b, 0x7b, 0x99, 0x51, 0x0c, 0xfb, 0xc9, 0xa4, 0xcf, 0x34, 0x6d, 0x89, 0x30, 0x3d, 0x84,
+  0xcd, 0x30, 0xa2, 0x68, 0xaa, 0x25, 0xe4, 0x1c, 0x02, 0x94, 0x6c, 0xb8, 0x88, 0xb8, 0x92, 0x29,
+  0x9c, 0xba, 0xaf, 0xee, 0x3b, 0x6b, 0x77, 0x9c, 0x5f, 0x7e, 0xda, 0xba, 0x74, 0xc3, 0xb9, 0xf5,
+  0x34, 0x8a, 0x2b, 0x77, 0xfb, 0xbe, 0x18, 0x59, 0x74, 0x1b, 0x41, 0xf3, 0x10, 0x30, 0x51, 0x73,
+  0x30, 0x36, 0x92, 0x98, 0x01, 0x19, 0x0f, 0x46, 0xce, 0x97, 0xeb, 0xdd, 0x17, 0x3f, 0x01, 0xd1,
+  0xda, 0x84, 0x90, 0x64, 0x01, 0x66, 0xbb, 0x29, 0x3a, 0xa9, 0x7b, 0x0b, 0x05, 0x4e, 0x81, 0x6f,
+  0x63, 0x91, 0x67, 0xd8, 0x77, 0xb1, 0x30, 0x3a, 0x55, 0xed, 0x3e, 0xbf, 0xda, 0x7d, 0xf9, 0x00,
+  0x28, 0x35, 0xcd, 0x00, 0x7c, 0xad, 0xde, 0xed, 0x4b, 0xdd, 0x17, 0x3f, 0x6d, 0xbe, 0xfa, 0x72,
+  0xf3, 0xe1, 0x75, 0xe7, 0xde, 0xb7, 0xfd, 0xf5, 0x57, 0x7c, 0xe1, 0xdf, 0xce, 0x9e, 0xe7, 0x1f,
+  0x36, 0x5f, 0x5d, 0xea, 0x7f, 0x7b, 0xad, 0xfb, 0x7c, 0x6d, 0xf3, 0xe9, 0xcf, 0xce, 0xb5, 0x57,
+  0xbd, 0xdb, 0x6b, 0xfd, 0xcf, 0xff, 0xf1, 0xdb, 0xd9, 0xf3, 0xe5, 0x9c, 0x95, 0x8c, 0x25, 0x2f,
+  0xe0, 0xe2, 0xfa, 0x0e, 0xbe, 0x09, 0x67, 0xbe, 0xde, 0x69, 0x23, 0x83, 0x28, 0x4d, 0x44, 0xf6,
+  0xe9, 0x88, 0x7e, 0x7c, 0x7b, 0xe5, 0xa0, 0x9a, 0x96, 0xe8, 0xd8, 0x86, 0xa6, 0x23, 0x29, 0xa3,
+  0xb0, 0xa1, 0x54, 0x8f, 0x02, 0xaa, 0xfa, 0xe7, 0x7f, 0x71, 0x2e, 0xbd, 0xe8, 0x5d, 0xbe, 0xdd,
+  0xbb, 0x76, 0xbb, 0x77, 0x6d, 0x43, 0xe4, 0xdf, 0xb9, 0xfc, 0xac, 0xb7, 0xf6, 0xd8, 0x79, 0x7c,
+  0x61, 0x10, 0x08, 0x29, 0xd9, 0x80, 0x21, 0xfe, 0xcd, 0x15, 0xa5, 0x17, 0xe1, 0xd0, 0xb4, 0x3c,
+  0x05, 0x68, 0xe0, 0x64, 0x91, 0x4a, 0x8a, 0x8a, 0x88, 0xf1, 0xdc, 0xa2, 0x69, 0x4b, 0x25, 0xd5,
+  0xb1, 0x74, 0x13, 0xaa, 0x87, 0x17, 0x76, 0x87, 0x98, 0x1a, 0x72, 0xa4, 0xc4, 0xb0, 0x2d, 0x58,
+  0xd9, 0x6b, 0x4d, 0x5e, 0xbd, 0x1a, 0x3a, 0x93, 0x9a, 0xae, 0x87, 0x58, 0xd6, 0x3d, 0x7c, 0x26,
+  0xad, 0xea, 0x8d, 0xdb, 0x2e, 0x92, 0x77, 0x53, 0x47, 0x35, 0x3e, 0x96, 0x5d, 0xbf, 0x36, 0x1e,
+  0x9a, 0xc3, 0xde, 0x2f, 0x66, 0x12, 0x29, 0xcb, 0xee, 0x73, 0x2d, 0x1e, 0x32, 0xb8, 0x22, 0x89,
+  0x00, 0x59, 0xcc, 0xa0, 0x26, 0xe7, 0xe3, 0xc0, 0x4f, 0x55, 0x9d, 0xab, 0x0f, 0x36, 0x37, 0x36,
+  0xba, 0xcf, 0xd7, 0x14, 0x45, 0x19, 0xb9, 0x6f, 0xf7, 0x03, 0x7b, 0xe6, 0x55, 0xc7, 0x9a, 0x45,
+  0x78, 0x7f, 0x2e, 0xc7, 0x84, 0x60, 0x2f, 0x69, 0xa4, 0xde, 0xd2, 0x8c, 0x26, 0x6b, 0xf4, 0x91,
+  0xfa, 0x61, 0x07, 0xe1, 0x95, 0x63, 0x48, 0x47, 0x75, 0x62, 0xe2, 0xdd, 0xba, 0x9e, 0x96, 0x68,
+  0x31, 0x5f, 0xca, 0xd0, 0xcb, 0xba, 0x7d, 0xb0, 0xde, 0x4a, 0x13, 0x50, 0xa9, 0xfa, 0x31, 0x1c,
+  0x51, 0xa0, 0xaa, 0xee, 0x5b, 0x44, 0x06, 0x79, 0x47, 0xb3, 0x09, 0x32, 0x10, 0x4e, 0x4b, 0x0c,
+  0xd0, 0x52, 0x16, 0xa4, 0x33, 0xe2, 0xc8, 0xed, 0x2c, 0xb1, 0x4c, 0x27, 0x2e, 0x2b, 0x4c, 0xdc,
+  0x94, 0xae, 0x82, 0x51, 0xdb, 0x5c, 0x44, 0x69, 0x89, 0x07, 0x01, 0x52, 0x50, 0x1b, 0x1b, 0x4e,
+  0x95, 0xe9, 0xf4, 0x35, 0xe9, 0x12, 0x61, 0x18, 0x54, 0xd5, 0x60, 0xcc, 0xa8, 0xa5, 0xbd, 0x75,
+  0x8f, 0x07, 0x50, 0x92, 0x26, 0x88, 0x42, 0xbf, 0xd9, 0x88, 0xd0, 0x9d, 0x4e, 0x48, 0xa9, 0x13,
+  0xec, 0xe0, 0x8f, 0xa0, 0xaf, 0x35, 0x40, 0x3a, 0x34, 0xb1, 0x52, 0xa9, 0x48, 0x0c, 0x96, 0x52,
+  0x06, 0xd0, 0x33, 0xba, 0x97, 0x41, 0xea, 0xa0, 0xd1, 0x30, 0xd3, 0xa3, 0xa6, 0x71, 0x1f, 0xef,
+  0xce, 0xf3, 0x7c, 0x87, 0x37, 0xe7, 0x8c, 0x17, 0xb9, 0x67, 0xe6, 0x77, 0x78, 0x10, 0x39, 0xc6,
+  0x42, 0x1f, 0x60, 0xb3, 0x5d, 0xb1, 0x9c, 0x8a, 0x16, 0x10, 0xec, 0x2c, 0x60, 0xd5, 0x84, 0xba,
+  0xd9, 0x31, 0x88, 0x0d, 0xa0, 0xa1, 0xfa, 0x25, 0x1d, 0x7e, 0x85, 0x6b, 0x83, 0xba, 0xd9, 0x46,
+  0xa0, 0x81, 0xcd, 0x36, 0x20, 0x2d, 0xe4, 0x51, 0x6b, 0x68, 0xb8, 0xbd, 0x04, 0x31, 0x92, 0x6c,
+  0xc0, 0x63, 0x2a, 0x80, 0x51, 0x53, 0xb3, 0x09, 0x5e, 0x01, 0xe9, 0x1c, 0xb4, 0xb4, 0x1c, 0x6f,
+  0xb5, 0xb3, 0x00, 0xa3, 0x45, 0xa8, 0x6b, 0x2a, 0x24, 0x48, 0x05, 0xb5, 0x15, 0xb0, 0x6f, 0x01,
+  0x36, 0x33, 0x3b, 0xdc, 0x92, 0xa3, 0xcb, 0x0d, 0x52, 0x5d, 0xe6, 0x2a, 0x40, 0xb2, 0x35, 0xa3,
+  0xa9, 0x23, 0xb7, 0xbe, 0xc4, 0x86, 0x70, 0x42, 0xa0, 0x02, 0x56, 0xcf, 0xb8, 0xbb, 0x81, 0xf6,
+  0x8a, 0x51, 0x07, 0x8d, 0x8e, 0x51, 0xe7, 0x7c, 0x9a, 0xd0, 0x25, 0x60, 0xa7, 0x83, 0x6c, 0x84,
+  0xb2, 0x12, 0x60, 0xb5, 0x6e, 0x1a, 0x36, 0x01, 0x18, 0x51, 0x3a, 0x70, 0x09, 0x6a, 0x04, 0x34,
+  0x10, 0xa9, 0xb7, 0xd2, 0x92, 0xc8, 0xac, 0xa8, 0x2b, 0x3e, 0x81, 0x0a, 0xdd, 0x9f, 0x81, 0x91,
+  0xad, 0x7c, 0x60, 0x9b, 0x46, 0x3a, 0x36, 0x8c, 0x65, 0x3c, 0x15, 0x30, 0xd0, 0x3b, 0x08, 0x61,
+  0xa7, 0xb8, 0x06, 0xfd, 0xae, 0x68, 0x86, 0x81, 0xf0, 0x81, 0x85, 0x43, 0xef, 0xd0, 0xdd, 0x4b,
+  0x02, 0x18, 0x21, 0x81, 0x6e, 0x46, 0x65, 0xfb, 0x80, 0xb7, 0xad, 0xf0, 0x11, 0x04, 0x9e, 0x78,
+  0x8e, 0xdb, 0x96, 0xa2, 0xa9, 0x27, 0x40, 0x05, 0xd8, 0xd6, 0xbc, 0xd0, 0xcd, 0xf9, 0xab, 0x89,
+  0xcc, 0xd5, 0x31, 0x82, 0x04, 0xb9, 0xfc, 0xa5, 0x25, 0x55, 0x5b, 0x14, 0x79, 0x02, 0xa0, 0xc6,
+  0x81, 0xfc, 0x2e, 0xad, 0x62, 0x51, 0x85, 0xf8, 0xd5, 0x7b, 0x09, 0x4c, 0x80, 0x34, 0x5b, 0x07,
+  0x54, 0x2a, 0x95, 0xa8, 0xee, 0x76, 0x01, 0xc9, 0x8d, 0xe9, 0x25, 0x40, 0x2b, 0x84, 0x11, 0x9a,
+  0x3e, 0x7c, 0x57, 0x2c, 0xc4, 0xb8, 0x54, 0x82, 0xc7, 0x28, 0x7c, 0x84, 0x28, 0x08, 0xdb, 0xe2,
+  0x55, 0xb4, 0x09, 0x20, 0x95, 0xd9, 0x9b, 0x81, 0x2a, 0x5d, 0xdc, 0xb6, 0x14, 0x86, 0x53, 0xda,
+  0xec, 0xbc, 0x7c, 0x20, 0xb1, 0xee, 0x9c, 0xdb, 0x1f, 0x26, 0x36, 0xbe, 0x15, 0xf3, 0x15, 0x91,
+  0x60, 0x6f, 0x84, 0xbd, 0xbf, 0x9e, 0xd1, 0x11, 0xe4, 0x39, 0xcc, 0x30, 0x30, 0x45, 0x46, 0x8f,
+  0x42, 0x4c, 0x44, 0x67, 0x42, 0x33, 0x18, 0xcf, 0xd0, 0xb2, 0x90, 0xa1, 0xee, 0x69, 0x69, 0xba,
+  0x9a, 0xae, 0x09, 0xdd, 0xc1, 0xd0, 0x33, 0xa0, 0x0e, 0x29, 0xd0, 0x51, 0x26, 0xc9, 0x72, 0x0f,
+  0x05, 0x6a, 0x18, 0x9a, 0xa1, 0xbc, 0x2a, 0xb8, 0x01, 0x66, 0x37, 0xaa, 0xa9, 0x2a, 0xcf, 0xc4,
+  0xb8, 0x37, 0x73, 0x1e, 0xff, 0xb0, 0xf9, 0xe3, 0xdf, 0x4a, 0x40, 0x9a, 0x40, 0x4a, 0x1b, 0xd9,
+  0x36, 0x6c, 0xa2, 0x09, 0x89, 0xfb, 0x2e, 0x5f, 0x4b, 0x67, 0x84, 0x9b, 0x85, 0xd0, 0xf9, 0x4d,
+  0x3e, 0xe2, 0x5e, 0xae, 0x25, 0x96, 0xa2, 0x29, 0xae, 0x89, 0x31, 0xec, 0xd8, 0x79, 0x49, 0x5b,
+  0x20, 0x6a, 0xfa, 0xe8, 0x85, 0xba, 0xde, 0x3d, 0xee, 0x5d, 0x43, 0x05, 0x48, 0xbd, 0xb5, 0x47,
+  0xce, 0xbd, 0x6f, 0x79, 0x0a, 0xa7, 0x28, 0x8a, 0x24, 0x0e, 0x55, 0x35, 0x1b, 0xd6, 0x74, 0x44,
+  0xb5, 0x41, 0x70, 0x27, 0x28, 0x6d, 0x6f, 0xdb, 0xb4, 0xec, 0x62, 0xa1, 0x1c, 0xc3, 0x70, 0x48,
+  0xcd, 0xdb, 0x37, 0x38, 0x18, 0x19, 0x2a, 0xc2, 0x47, 0x79, 0xd6, 0x98, 0xa6, 0xc3, 0x5f, 0x53,
+  0xd5, 0x6e, 0xe2, 0xb9, 0x3d, 0x35, 0x73, 0x31, 0x8d, 0xaf, 0xe0, 0x64, 0x89, 0x33, 0x22, 0x83,
+  0x04, 0xdd, 0x80, 0xba, 0xed, 0xd7, 0xb4, 0xd8, 0x7f, 0x3e, 0x0a, 0x12, 0xf6, 0x1e, 0x01, 0x04,
+  0xd2, 0x87, 0xe1, 0xc1, 0xdf, 0xf2, 0x7c, 0x68, 0x92, 0xeb, 0xe7, 0x2a, 0xd4, 0xb8, 0xb9, 0xc6,
+  0x34, 0xa4, 0xa4, 0x13, 0xe0, 0xf4, 0x69, 0xb0, 0x7a, 0x26, 0xa3, 0x78, 0x9e, 0xd1, 0xa6, 0x0d,
+  0xc7, 0x4f, 0x08, 0x6f, 0x67, 0xd8, 0x2f, 0x07, 0x44, 0xc5, 0x17, 0xba, 0x95, 0x4c, 0x55, 0x69,
+  0x4a, 0x0b, 0xfa, 0x0f, 0xbf, 0xef, 0xbe, 0xf8, 0xa9, 0x7f, 0xef, 0xbf, 0xb7, 0xee, 0xde, 0xec,
+  0xdd, 0x5b, 0x8f, 0x08, 0x8d, 0x51, 0x99, 0xa0, 0x64, 0x5a, 0x45, 0x2f, 0xa4, 0x8c, 0x27, 0x43,
+  0x29, 0x66, 0x0c, 0xd3, 0x82, 0x83, 0x38, 0x7d, 0xda, 0x15, 0x6a, 0xff, 0xc5, 0x67, 0xbd, 0xaf,
+  0xee, 0x49, 0x19, 0x6e, 0x19, 0x5b, 0xc5, 0x80, 0x34, 0x1b, 0x4d, 0x5d, 0x7d, 0xe0, 0x4c, 0xd2,
+  0xf5, 0x2c, 0xd0, 0x22, 0xd6, 0x50, 0x90, 0x08, 0xa8, 0xb8, 0x92, 0x39, 0xae, 0x31, 0x09, 0xa4,
+  0xa5, 0xee, 0xc6, 0x8d, 0xfe, 0xc6, 0x13, 0x20, 0x4d, 0xa4, 0xb5, 0x89, 0x42, 0x26, 0x86, 0x5d,
+  0xcd, 0x3e, 0x8a, 0x16, 0x41, 0x05, 0xd4, 0x15, 0xf6, 0x89, 0xd5, 0xca, 0xa3, 0x63, 0x3a, 0x16,
+  0x1b, 0xe0, 0x16, 0xa3, 0x0f, 0x37, 0xde, 0x73, 0xeb, 0xf5, 0xa7, 0x4f, 0x87, 0x9c, 0x9f, 0x77,
+  0xa6, 0x16, 0xc3, 0xa3, 0x3d, 0xaa, 0xc9, 0xc3, 0xdd, 0xbc, 0xfa, 0x1d, 0x97, 0x79, 0xce, 0xce,
+  0x2e, 0x20, 0x6d, 0x9d, 0xbd, 0xd8, 0xdd, 0xb8, 0xe1, 0xdc, 0xfa, 0x7b, 0xf7, 0x97, 0x2b, 0xcc,
+  0x37, 0xf5, 0xd6, 0x1e, 0x05, 0x0d, 0x51, 0x2a, 0x7e, 0x45, 0x2c, 0x46, 0x27, 0x34, 0x8d, 0xd2,
+  0x09, 0x11, 0x1e, 0xc0, 0xcd, 0x02, 0x5a, 0x26, 0x02, 0x11, 0xba, 0xa5, 0x12, 0xe8, 0x58, 0x03,
+  0x57, 0x8d, 0x8c, 0xef, 0x58, 0x80, 0x5e, 0x99, 0x2e, 0x06, 0xe3, 0x03, 0x8c, 0x84, 0xae, 0xf0,
+  0xfc, 0x77, 0x21, 0x54, 0x3b, 0x74, 0xf2, 0x2e, 0xc9, 0x7b, 0xaf, 0x20, 0x95, 0x24, 0x29, 0x33,
+  0x21, 0xa5, 0x44, 0x1f, 0x99, 0x48, 0x45, 0x2c, 0xe1, 0x70, 0x90, 0x71, 0x20, 0x30, 0x30, 0x85,
+  0x80, 0x3a, 0x80, 0x00, 0xf5, 0xd9, 0x7c, 0x62, 0xdd, 0xf3, 0xdf, 0x1e, 0x33, 0x20, 0xcd, 0xa5,
+  0x95, 0x91, 0x4a, 0x12, 0x48, 0x73, 0x51, 0x66, 0x3c, 0xa0, 0x8e, 0x4b, 0x5b, 0x46, 0x86, 0x48,
+  0x7e, 0x9f, 0x41, 0xa7, 0x03, 0x19, 0xf0, 0x26, 0x88, 0xeb, 0xd0, 0x80, 0x23, 0x28, 0x8a, 0x57,
+  0xbe, 0xf1, 0x67, 0x2f, 0x89, 0xc2, 0x73, 0xdf, 0x94, 0xb8, 0x32, 0xf4, 0x47, 0xf0, 0xfd, 0x48,
+  0x25, 0x17, 0x17, 0xb4, 0xdb, 0xbd, 0x24, 0x1e, 0xb5, 0x15, 0x17, 0xcf, 0xa9, 0x6a, 0x99, 0x3f,
+  0xdc, 0xa8, 0x4a, 0x13, 0x22, 0x76, 0x27, 0xa4, 0x12, 0xbd, 0xe8, 0x66, 0x3d, 0xc0, 0xef, 0xa2,
+  0xc0, 0x98, 0x18, 0x53, 0x56, 0xfe, 0xbb, 0x10, 0x0f, 0x55, 0xe2, 0x52, 0x61, 0x80, 0x47, 0x16,
+  0x0b, 0xe1, 0x70, 0xe8, 0x72, 0x11, 0x73, 0xef, 0x5b, 0x03, 0x9a, 0x6a, 0x68, 0x6d, 0x4b, 0x47,
+  0xc0, 0xab, 0x2e, 0xee, 0x18, 0xc2, 0xa9, 0x37, 0x26, 0x55, 0x2d, 0xb7, 0xa6, 0xaa, 0xfd, 0x27,
+  0x67, 0x37, 0xff, 0xe7, 0x9c, 0x73, 0xf9, 0x62, 0xef, 0xab, 0x5b, 0xe5, 0x5c, 0x6b, 0xaa, 0x5a,
+  0xb6, 0x82, 0x25, 0x68, 0x1a, 0x24, 0x58, 0x31, 0x1d, 0x19, 0x4d, 0xd2, 0x62, 0x91, 0x68, 0x21,
+  0x13, 0xb3, 0x60, 0x75, 0xea, 0x07, 0xfc, 0xc1, 0xc7, 0xf3, 0x27, 0x12, 0xb6, 0xd0, 0xdd, 0x78,
+  0xd0, 0xbb, 0xba, 0xe1, 0x5c, 0x7e, 0xd6, 0x5d, 0xbf, 0x18, 0x88, 0x87, 0x43, 0x8b, 0xe9, 0xd2,
+  0x6b, 0x4a, 0x8b, 0x16, 0x6d, 0x97, 0x24, 0x20, 0x39, 0x00, 0xf2, 0x44, 0x28, 0x98, 0xa3, 0xff,
+  0xa4, 0xdf, 0xce, 0x9e, 0xdf, 0x7c, 0xf5, 0x57, 0xe7, 0xe5, 0x83, 0xfe, 0x95, 0xeb, 0xdd, 0x17,
+  0x8f, 0x36, 0x1f, 0x7e, 0x4b, 0x5d, 0x66, 0x98, 0x58, 0x82, 0x71, 0x2b, 0xc5, 0xcd, 0xe3, 0x20,
+  0xea, 0x4f, 0x7f, 0xee, 0xbf, 0xf8, 0xcc, 0xb9, 0x75, 0xb9, 0xbb, 0xf1, 0xc0, 0xd9, 0xf8, 0xcc,
+  0xb9, 0x72, 0xa3, 0x7f, 0xf7, 0x82, 0xf3, 0xf8, 0x82, 0xf3, 0xf5, 0x47, 0xce, 0x7f, 0x5d, 0xdf,
+  0xfa, 0xcb, 0x93, 0xad, 0xaf, 0xef, 0xf4, 0xee, 0xff, 0xad, 0x7f, 0xeb, 0xe2, 0xe6, 0x37, 0x8f,
+  0x7c, 0x56, 0xfa, 0x77, 0x2f, 0xf4, 0xae, 0x5f, 0x72, 0x5e, 0x7e, 0xf1, 0xdb, 0xd9, 0xf3, 0x81,
+  0xfe, 0x00, 0xd2, 0x6d, 0x14, 0x13, 0x23, 0x33, 0xd7, 0xa2, 0xeb, 0xd0, 0x74, 0x82, 0x70, 0xba,
+  0x5e, 0xa9, 0xbe, 0x21, 0x6e, 0x23, 0xe3, 0x6a, 0x23, 0xd9, 0x80, 0x27, 0xce, 0x1f, 0x67, 0x7a,
+  0x1b, 0x7e, 0x60, 0xe2, 0xc1, 0x04, 0xf8, 0x79, 0xa7, 0xc9, 0x30, 0x1b, 0x28, 0xc5, 0xc9, 0xf8,
+  0xaa, 0x76, 0x3e, 0xfe, 0x41, 0x9a, 0x88, 0x81, 0x67, 0x42, 0x72, 0x95, 0xf3, 0x7c, 0xed, 0xf7,
+  0x97, 0xd7, 0x03, 0x08, 0x74, 0x2c, 0xd6, 0xc3, 0x75, 0xeb, 0xe3, 0xe0, 0xb7, 0xb3, 0xe7, 0x82,
+  0x21, 0x18, 0x2d, 0xb2, 0x31, 0x1c, 0x0a, 0x01, 0x56, 0xc2, 0x59, 0x3b, 0xdf, 0x40, 0x15, 0xe4,
+  0x33, 0x01, 0x2b, 0xbf, 0xbf, 0xbc, 0xee, 0x7c, 0xfc, 0x53, 0xf7, 0xf9, 0x5a, 0x40, 0x8c, 0x0d,
+  0x63, 0xe4, 0x9c, 0xc7, 0xdf, 0x6c, 0xdd, 0x79, 0xe5, 0xdc, 0x78, 0xd8, 0x5f, 0xff, 0x5f, 0x9f,
+  0xe8, 0xef, 0x2f, 0xaf, 0xf7, 0xee, 0xfc, 0xda, 0x7f, 0xbc, 0xee, 0x5c, 0x5a, 0x77, 0x3e, 0xdd,
+  0xd8, 0x7c, 0x75, 0xcb, 0xf9, 0xe1, 0xfc, 0xd6, 0xfd, 0xaf, 0xfb, 0x77, 0x2f, 0xd0, 0x1b, 0xe2,
+  0xc7, 0xdf, 0x38, 0x1b, 0x3f, 0x38, 0x9f, 0xdd, 0x48, 0x3a, 0xa5, 0xa2, 0x8a, 0x39, 0x4b, 0x1d,
+  0x0b, 0x54, 0xa9, 0x5e, 0x04, 0x8e, 0x7a, 0x5f, 0xfc, 0xd8, 0xdd, 0xf8, 0x6c, 0xf3, 0xa3, 0x8d,
+  0xad, 0x4b, 0x37, 0x9d, 0x73, 0x37, 0x9d, 0x5b, 0x9f, 0xf6, 0xbf, 0x79, 0xda, 0xfb, 0xea, 0x5c,
+  0x6f, 0xed, 0xd1, 0xd6, 0xfd, 0xaf, 0xc3, 0x24, 0x18, 0x4a, 0x28, 0x1d, 0xaa, 0xda, 0x2a, 0xe8,
+  0x58, 0x31, 0x3a, 0x5b, 0xf7, 0xe8, 0x19, 0xee, 0x7d, 0xf9, 0xa3, 0xf3, 0xf8, 0x2e, 0x85, 0xe3,
+  0xcd, 0x1b, 0xbd, 0xb3, 0xf7, 0xbb, 0xcf, 0x3f, 0xd9, 0x7c, 0xf6, 0x51, 0xef, 0x8b, 0x1f, 0x13,
+  0xa8, 0x05, 0xf3, 0xd7, 0x1e, 0xb9, 0x1e, 0xf5, 0xfe, 0xa5, 0xcd, 0x87, 0x0f, 0xe9, 0xb6, 0xef,
+  0xfe, 0xa5, 0xff, 0x78, 0xbd, 0xbb, 0x7e, 0xad, 0x7f, 0xe5, 0x3b, 0xe7, 0xf1, 0x85, 0xee, 0xfa,
+  0x27, 0x9b, 0x1b, 0xdf, 0xf7, 0xae, 0xde, 0xe9, 0x9f, 0xff, 0x25, 0x04, 0xde, 0x98, 0x85, 0xc9,
+  0x59, 0xd5, 0x88, 0x81, 0x42, 0x7a, 0x28, 0xce, 0xa5, 0x43, 0x43, 0x41, 0x66, 0xc2, 0x9d, 0x82,
+  0x77, 0xab, 0xf2, 0x5a, 0x57, 0x0a, 0xde, 0xfd, 0xcc, 0xb6, 0x03, 0xfc, 0x81, 0xd1, 0xab, 0x57,
+  0x33, 0x91, 0x32, 0xca, 0x22, 0xd4, 0x3b, 0xc8, 0x3b, 0x18, 0xb4, 0x2d, 0x1c, 0x10, 0x89, 0x89,
+  0xc0, 0x99, 0x21, 0x9b, 0x14, 0xcb, 0x0e, 0x91, 0x40, 0x9a, 0x11, 0xad, 0x8c, 0xcf, 0x8c, 0x42,
+  0xb0, 0xd6, 0x4e, 0x47, 0x02, 0x6b, 0x5a, 0x2c, 0x19, 0x45, 0x84, 0x8e, 0xf1, 0x88, 0x88, 0x96,
+  0xfe, 0x0d, 0x4a, 0x3d, 0x03, 0x56, 0x01, 0xd4, 0x11, 0x26, 0x69, 0x89, 0xd6, 0x97, 0x40, 0xf7,
+  0xf9, 0x8d, 0xcd, 0x8f, 0x36, 0xba, 0xcf, 0xd7, 0xfb, 0xdf, 0xad, 0x4b, 0x99, 0x79, 0x80, 0x11,
+  0xe9, 0x60, 0x23, 0xa8, 0x21, 0xbf, 0x86, 0x82, 0xb2, 0xa1, 0xab, 0x80, 0x36, 0x22, 0x2d, 0x53,
+  0x2d, 0x49, 0x47, 0x0e, 0x1f, 0x5b, 0x90, 0xb2, 0x42, 0x07, 0xaf, 0x29, 0xdb, 0xa5, 0x55, 0xc9,
+  0x4d, 0x64, 0xe4, 0x85, 0x15, 0x0b, 0x49, 0x25, 0x89, 0xfe, 0xd6, 0xa7, 0x56, 0x67, 0x31, 0x44,
+  0x6e, 0x59, 0x5e, 0x5a, 0x5a, 0x92, 0x59, 0x41, 0xaa, 0x83, 0x75, 0x64, 0xd4, 0x4d, 0x15, 0xa9,
+  0xd2, 0x19, 0x91, 0x0e, 0xad, 0x57, 0x97, 0x24, 0xba, 0xb7, 0x8a, 0x34, 0xc1, 0x47, 0xbc, 0x77,
+  0xf4, 0xe0, 0x1e, 0xb3, 0x6d, 0x99, 0x06, 0xbd, 0x8e, 0x61, 0xbb, 0x9e, 0x90, 0xfe, 0xcd, 0xab,
+  0x3c, 0x25, 0x8f, 0xa2, 0xbd, 0x99, 0x1d, 0x49, 0xf7, 0x02, 0xff, 0x12, 0x90, 0xb1, 0xb4, 0x6f,
+  0xcc, 0xc4, 0x50, 0x9a, 0xe0, 0x4e, 0xd9, 0x3c, 0xb9, 0x4b, 0x72, 0x5f, 0x5e, 0x49, 0x25, 0x89,
+  0xa5, 0x8b, 0x5e, 0xc0, 0xc4, 0xfa, 0xdd, 0x3c, 0xf1, 0xf4, 0x69, 0xf6, 0x8d, 0xf5, 0xc7, 0x73,
+  0xc6, 0x6d, 0x25, 0xb0, 0xdb, 0x66, 0xd5, 0xcd, 0x61, 0xc7, 0xb9, 0x96, 0x48, 0x3a, 0x2d, 0x42,
+  0x19, 0x25, 0x72, 0x58, 0x68, 0x4d, 0x66, 0x18, 0xce, 0x85, 0xe2, 0x10, 0xfd, 0x4f, 0x0c, 0x47,
+  0x18, 0xd4, 0x69, 0x63, 0xc6, 0x03, 0x73, 0xf8, 0x04, 0xd5, 0x46, 0xd1, 0xf5, 0xaa, 0x32, 0xd1,
+  0xa4, 0x96, 0x3d, 0xb6, 0x19, 0xcd, 0x93, 0x1e, 0x9d, 0xc7, 0xe5, 0x35, 0x6a, 0xa6, 0x27, 0x77,
+  0xff, 0x8d, 0x4c, 0x4d, 0x61, 0xe9, 0xaa, 0xe2, 0xd6, 0x84, 0x2a, 0x12, 0x7b, 0xee, 0xeb, 0xcb,
+  0x95, 0xae, 0xe4, 0x8e, 0xe0, 0xbf, 0xeb, 0x2e, 0xe5, 0xdf, 0xf4, 0x3b, 0x39, 0xb1, 0x40, 0x85,
+  0x95, 0xc0, 0x92, 0xb9, 0x7b, 0x31, 0x71, 0x1b, 0x54, 0x80, 0x81, 0x96, 0xc0, 0x7e, 0x13, 0xb7,
+  0xf7, 0x42, 0x02, 0xd3, 0xc2, 0x13, 0x59, 0xdc, 0x76, 0xef, 0xc1, 0xd2, 0x92, 0x7f, 0x2d, 0x9d,
+  0x65, 0x4a, 0x89, 0xec, 0x6d, 0xb9, 0x85, 0x5d, 0x32, 0xff, 0x79, 0xe8, 0x9d, 0x03, 0x84, 0x58,
+  0x47, 0xd1, 0x87, 0x1d, 0x64, 0x93, 0x80, 0xd8, 0x72, 0x0b, 0x2b, 0x5c, 0xcf, 0x8a, 0x69, 0x78,
+  0xa2, 0xa5, 0x37, 0x03, 0x88, 0xe7, 0xc9, 0x40, 0x6b, 0xa4, 0x91, 0x1b, 0x3d, 0xd0, 0xe3, 0xd8,
+  0x21, 0xf4, 0xda, 0x22, 0x13, 0xdf, 0x1f, 0x1d, 0x65, 0x42, 0x15, 0xa9, 0x39, 0xa4, 0x10, 0x93,
+  0x40, 0xfd, 0x0f, 0x85, 0x7c, 0x3e, 0x33, 0x21, 0xbd, 0x29, 0xcd, 0x83, 0x33, 0xe2, 0x6a, 0xa6,
+  0x41, 0xc7, 0xd1, 0x25, 0x22, 0x99, 0x78, 0xd8, 0x96, 0xf9, 0xd6, 0x0c, 0x54, 0xc0, 0x9f, 0x8f,
+  0x1d, 0x7e, 0x57, 0xb1, 0xe8, 0xdf, 0x18, 0x48, 0x53, 0x0a, 0x18, 0xd9, 0x96, 0x69, 0xd8, 0x68,
+  0x41, 0x7c, 0x38, 0x9c, 0x2c, 0xd7, 0xc1, 0x67, 0x18, 0x0f, 0x3b, 0xc0, 0x69, 0x1c, 0x1c, 0x5f,
+  0xcc, 0xcf, 0x6e, 0x26, 0x21, 0x37, 0x48, 0x3c, 0xbe, 0xdb, 0x60, 0xc3, 0x3f, 0x9f, 0xd1, 0x5d,
+  0x25, 0xad, 0xe5, 0x1d, 0xd8, 0xb0, 0x2c, 0xf9, 0xfb, 0x4e, 0x5f, 0x98, 0xdb, 0x5e, 0x9b, 0x17,
+  0x99, 0xf9, 0xfd, 0x96, 0xb7, 0x66, 0x64, 0x0d, 0x0b, 0x19, 0x69, 0xd7, 0x3f, 0x00, 0xee, 0x49,
+  0x4c, 0x02, 0xa5, 0x10, 0x82, 0x6c, 0x8a, 0x45, 0x8a, 0xcb, 0x4c, 0x28, 0xc4, 0xc8, 0xe5, 0x58,
+  0x75, 0x9c, 0x3e, 0xe6, 0x63, 0x85, 0x16, 0x5a, 0x5b, 0xde, 0x21, 0x18, 0x6d, 0xfa, 0xb2, 0x71,
+  0xc4, 0xb9, 0xa3, 0x63, 0xbc, 0xb5, 0xd8, 0xcb, 0xc0, 0xf8, 0x3d, 0x37, 0x25, 0x4f, 0x9f, 0xe8,
+  0x49, 0x59, 0x80, 0x2a, 0xd5, 0x55, 0xa4, 0x58, 0x34, 0x95, 0x35, 0xc8, 0x5e, 0xd4, 0x80, 0x1d,
+  0x9d, 0x62, 0x9d, 0x4d, 0x8c, 0xdc, 0x49, 0xfb, 0x2f, 0x0c, 0xa5, 0xcc, 0xfc, 0x99, 0xd1, 0x0b,
+  0xe8, 0x08, 0x2e, 0x22, 0x76, 0x99, 0x5e, 0xa9, 0x46, 0xc8, 0x79, 0xb7, 0xe1, 0x02, 0xc5, 0x51,
+  0xf4, 0x4c, 0xcb, 0x65, 0xd6, 0x8b, 0xd5, 0xe2, 0x3c, 0x7b, 0xb7, 0x58, 0x23, 0xd7, 0x8a, 0x59,
+  0x41, 0xe6, 0xfe, 0x11, 0xab, 0x3f, 0x2c, 0xb0, 0xdf, 0x00, 0x43, 0x98, 0x5b, 0xe1, 0xc0, 0x04,
+  0xa7, 0xd9, 0x77, 0xf7, 0x58, 0x57, 0xf3, 0x99, 0x31, 0x9c, 0x4f, 0xd4, 0xa4, 0xd3, 0x8b, 0x4b,
+  0x91, 0x28, 0x10, 0xdd, 0x45, 0xc4, 0xbb, 0x64, 0x06, 0x97, 0xb1, 0xc4, 0x02, 0xe0, 0x6b, 0x85,
+  0x9d, 0xb4, 0x1a, 0x9d, 0x10, 0x74, 0xbe, 0x5e, 0x30, 0x20, 0x54, 0xb8, 0xc3, 0x2e, 0x56, 0x38,
+  0xdd, 0x52, 0xb9, 0xe6, 0x3e, 0xfd, 0x28, 0x95, 0x73, 0x35, 0x7a, 0x85, 0xa0, 0x2a, 0x9e, 0x15,
+  0x9e, 0x90, 0xca, 0x35, 0x5c, 0x95, 0x26, 0x22, 0xc3, 0x37, 0xaf, 0x3e, 0xed, 0x5f, 0xb9, 0xe4,
+  0x7c, 0x75, 0xcd, 0xb9, 0xf9, 0x73, 0x30, 0x89, 0x3e, 0xb8, 0x3b, 0x64, 0xaa, 0xf4, 0x46, 0x62,
+  0xc8, 0xac, 0xfe, 0x95, 0xcb, 0xbd, 0x7b, 0xdf, 0x87, 0x67, 0x1d, 0x45, 0x8b, 0x9a, 0xad, 0x99,
+  0xc6, 0x80, 0x89, 0x7b, 0x8e, 0xbc, 0x07, 0xb6, 0xbe, 0xfe, 0xb4, 0xff, 0xc9, 0x25, 0x61, 0x9a,
+  0xd5, 0xd9, 0x8f, 0xd1, 0x87, 0x87, 0x0e, 0x9c, 0x9a, 0x90, 0xc0, 0xa1, 0x03, 0xa7, 0x12, 0x27,
+  0xee, 0xd7, 0xa1, 0xdd, 0x02, 0x34, 0xbf, 0x7a, 0x76, 0xd3, 0x9b, 0x9a, 0x56, 0x95, 0x06, 0x6d,
+  0x3e, 0xa6, 0x9d, 0x42, 0xb9, 0x42, 0x7e, 0x72, 0x8a, 0xfd, 0xc8, 0x28, 0xc4, 0xdc, 0xaf, 0x2d,
+  0x23, 0x35, 0x5d, 0xc8, 0x50, 0x82, 0x6f, 0x27, 0xd2, 0x73, 0x6e, 0x3e, 0xed, 0x7f, 0xfe, 0xad,
+  0xf3, 0xe0, 0xa2, 0x73, 0xf1, 0x63, 0x67, 0xed, 0x8e, 0x48, 0x12, 0x23, 0x74, 0x00, 0x41, 0x2b,
+  0x89, 0xd8, 0xbf, 0x27, 0x13, 0xdb, 0x7d, 0x04, 0xd0, 0x90, 0x38, 0xd8, 0x12, 0x8d, 0x1c, 0x07,
+  0x48, 0xe0, 0xe0, 0x11, 0xe0, 0xdc, 0x7b, 0xe6, 0xdc, 0x3f, 0x1b, 0x8c, 0xd6, 0xac, 0xd7, 0x0b,
+  0xba, 0xc2, 0x90, 0x88, 0x5c, 0xec, 0x6f, 0x7e, 0xf2, 0xb3, 0x73, 0xf3, 0xb6, 0xf8, 0x74, 0x22,
+  0xa1, 0x52, 0x90, 0x18, 0x6a, 0xe5, 0x72, 0xe0, 0x1d, 0xea, 0x06, 0xa9, 0x3a, 0x01, 0xfb, 0x0b,
+  0x16, 0xa6, 0xc1, 0xfe, 0x02, 0x0e, 0x2f, 0x00, 0xc4, 0x00, 0xae, 0x90, 0x16, 0x32, 0xd2, 0xb8,
+  0x52, 0xc5, 0x2e, 0x9a, 0xdd, 0x16, 0x35, 0x30, 0x22, 0x83, 0xe3, 0x46, 0xef, 0x65, 0x67, 0x78,
+  0x03, 0x95, 0x10, 0x04, 0xc1, 0x1f, 0x63, 0x38, 0x39, 0x74, 0xe0, 0x94, 0xe4, 0x95, 0xd5, 0x15,
+  0x2e, 0x33, 0x6a, 0xfe, 0x56, 0x3d, 0x73, 0x19, 0x2d, 0xc4, 0x97, 0x73, 0xde, 0x23, 0x8d, 0x72,
+  0x8e, 0x3f, 0x53, 0x2d, 0xe7, 0xf8, 0xdf, 0x10, 0xfa, 0x3f, 0x7d, 0xed, 0x03, 0x2f, 0x55, 0x48,
+  0x00, 0x00,
+};
+
+#endif // WEB_UI_GZ_H
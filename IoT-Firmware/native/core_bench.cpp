@@ -0,0 +1,296 @@
+// Google Benchmark suite for the firmware hot paths, built natively against
+// the shims in shim/. Absolute numbers are host numbers; compare runs of the
+// same binary across commits to catch regressions (the on-device equivalent
+// is /api/bench).
+
+#include <Arduino.h>
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "draw_cbor.h"
+#include "draw_json.h"
+#include "drbg.h"
+#include "metrics.h"
+#include "serial_command.h"
+#include "spreads.h"
+#include "test_sources.h"
+
+namespace {
+
+#define BENCH_RING_WORDS 4096
+
+// A channel backed by a ring that is topped up, outside the timed region,
+// whenever it runs low, so reads measure the pool-hit path as on the device
+struct PoolChannel {
+  std::vector<uint32_t> ring;
+  EntropyChannel ch;
+
+  PoolChannel() : ring(BENCH_RING_WORDS) {
+    nativeRandomSeed(1);
+    healthState.store(HEALTH_OK);
+    ch.buf = ring.data();
+    ch.capacity = BENCH_RING_WORDS;
+    topUp();
+  }
+
+  void topUp() {
+    while (refillChannel(ch)) {}
+  }
+
+  void keepFull(benchmark::State& state) {
+    if (ch.level() >= BENCH_RING_WORDS / 4) return;
+    state.PauseTiming();
+    topUp();
+    state.ResumeTiming();
+  }
+};
+
+void BM_TrngRead32(benchmark::State& state) {
+  PoolChannel p;
+  for (auto _ : state) {
+    p.keepFull(state);
+    benchmark::DoNotOptimize(trngRead32(p.ch));
+  }
+  state.counters["underruns"] = p.ch.underruns.load();
+}
+BENCHMARK(BM_TrngRead32);
+
+// Ring empty: every read goes to the RNG and through the fallback health test
+void BM_TrngRead32Direct(benchmark::State& state) {
+  nativeRandomSeed(1);
+  healthState.store(HEALTH_OK);
+  EntropyChannel ch;
+  for (auto _ : state) benchmark::DoNotOptimize(trngRead32(ch));
+}
+BENCHMARK(BM_TrngRead32Direct);
+
+void BM_HealthTestWord(benchmark::State& state) {
+  nativeRandomSeed(1);
+  HealthTest t;
+  uint32_t w = esp_random();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(t.word(w));
+    w = w * 1664525u + 1013904223u;
+  }
+}
+BENCHMARK(BM_HealthTestWord);
+
+void BM_TrngUnbiased(benchmark::State& state) {
+  PoolChannel p;
+  uint32_t range = (uint32_t)state.range(0);
+  for (auto _ : state) {
+    p.keepFull(state);
+    benchmark::DoNotOptimize(trngUnbiased(p.ch, range));
+  }
+  state.counters["wordsPerOp"] = benchmark::Counter((double)p.ch.wordsConsumed.load() / state.iterations());
+}
+BENCHMARK(BM_TrngUnbiased)->Arg(78)->Arg(156)->Arg(1000);
+
+void BM_DrawSingleCard(benchmark::State& state) {
+  PoolChannel p;
+  for (auto _ : state) {
+    p.keepFull(state);
+    benchmark::DoNotOptimize(drawSingleCard(p.ch));
+  }
+}
+BENCHMARK(BM_DrawSingleCard);
+
+void BM_DrawMultipleCards(benchmark::State& state) {
+  PoolChannel p;
+  int count = (int)state.range(0);
+  DrawResult cards[TAROT_CARD_COUNT];
+  for (auto _ : state) {
+    p.keepFull(state);
+    drawMultipleCards(p.ch, cards, count);
+    benchmark::DoNotOptimize(cards);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_DrawMultipleCards)->Arg(3)->Arg(10)->Arg(78);
+
+// The same sampler over each source policy; the difference is the cost of the
+// source itself, since every pairing is inlined
+template <class Source>
+void BM_DrawSpreadBySource(benchmark::State& state) {
+  nativeRandomSeed(1);
+  healthState.store(HEALTH_OK);
+  Source src;
+  DrawResult cards[10];
+  for (auto _ : state) {
+    drawMultipleCards(src, cards, 10);
+    benchmark::DoNotOptimize(cards);
+  }
+}
+BENCHMARK_TEMPLATE(BM_DrawSpreadBySource, SplitMixSource);
+BENCHMARK_TEMPLATE(BM_DrawSpreadBySource, HardwareSource);
+
+// Bulk fills: raw channel/hardware against the ChaCha20 DRBG
+void BM_FillChannel(benchmark::State& state) {
+  PoolChannel p;
+  std::vector<uint8_t> buf(state.range(0));
+  for (auto _ : state) {
+    p.keepFull(state);
+    trngFill(p.ch, buf.data(), buf.size());
+    benchmark::DoNotOptimize(buf.data());
+  }
+  state.SetBytesProcessed(state.iterations() * buf.size());
+}
+BENCHMARK(BM_FillChannel)->Arg(1024);
+
+void BM_FillHardware(benchmark::State& state) {
+  nativeRandomSeed(1);
+  healthState.store(HEALTH_OK);
+  HardwareSource hw;
+  std::vector<uint8_t> buf(state.range(0));
+  for (auto _ : state) {
+    trngFill(hw, buf.data(), buf.size());
+    benchmark::DoNotOptimize(buf.data());
+  }
+  state.SetBytesProcessed(state.iterations() * buf.size());
+}
+BENCHMARK(BM_FillHardware)->Arg(1024);
+
+void BM_FillDrbg(benchmark::State& state) {
+  PoolChannel p;
+  DrbgSource<EntropyChannel> drbg(p.ch);
+  std::vector<uint8_t> buf(state.range(0));
+  for (auto _ : state) {
+    trngFill(drbg, buf.data(), buf.size());
+    benchmark::DoNotOptimize(buf.data());
+  }
+  state.SetBytesProcessed(state.iterations() * buf.size());
+  state.counters["reseeds"] = drbg.reseeds.load();
+}
+BENCHMARK(BM_FillDrbg)->Arg(1024)->Arg(65536);
+
+void BM_ChaCha20Block(benchmark::State& state) {
+  uint32_t key[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  uint32_t ctr[4] = {};
+  uint32_t out[16];
+  for (auto _ : state) {
+    chacha20Block(key, ctr, out);
+    ctr[0]++;
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * 64);
+}
+BENCHMARK(BM_ChaCha20Block);
+
+void BM_CardToJSON(benchmark::State& state) {
+  char buf[JSON_BUF_SIZE];
+  uint8_t i = 0;
+  for (auto _ : state) {
+    JsonOut out(buf, sizeof(buf));
+    cardToJSON(out, DrawResult{i, (bool)(i & 1)});
+    benchmark::DoNotOptimize(out.len);
+    i = (uint8_t)((i + 1) % TAROT_CARD_COUNT);
+  }
+}
+BENCHMARK(BM_CardToJSON);
+
+void BM_DrawResultsToJSON(benchmark::State& state) {
+  PoolChannel p;
+  int count = (int)state.range(0);
+  DrawResult cards[TAROT_CARD_COUNT];
+  drawMultipleCards(p.ch, cards, count);
+  static char buf[JSON_BUF_SIZE * 16];  // holds a full-deck reply in one pass
+  size_t bytes = 0;
+  for (auto _ : state) {
+    JsonOut out(buf, sizeof(buf));
+    drawResultsToJSON(out, cards, count, "bench");
+    benchmark::DoNotOptimize(out.len);
+    bytes += out.len;
+  }
+  state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_DrawResultsToJSON)->Arg(1)->Arg(10)->Arg(78);
+
+// Last window of a full-deck reply: the cost an async filler pays per TCP window
+void BM_DrawReplyWindow(benchmark::State& state) {
+  PoolChannel p;
+  DrawReply reply;
+  drawReplyFor(p.ch, reply, TAROT_CARD_COUNT, nullptr);
+  JsonOut sizing(nullptr, 0);
+  reply.toJSON(sizing);
+  char buf[1436];
+  for (auto _ : state) {
+    JsonOut out(buf, sizeof(buf), sizing.pos - sizeof(buf));
+    reply.toJSON(out);
+    benchmark::DoNotOptimize(out.len);
+  }
+}
+BENCHMARK(BM_DrawReplyWindow);
+
+// Compact reply for the same draws as BM_DrawResultsToJSON
+void BM_DrawReplyToCBOR(benchmark::State& state) {
+  PoolChannel p;
+  DrawReply reply;
+  drawReplyFor(p.ch, reply, (int)state.range(0), "bench", "bench");
+  char buf[256];
+  size_t bytes = 0;
+  for (auto _ : state) {
+    JsonOut out(buf, sizeof(buf));
+    drawReplyToCBOR(out, reply, true, 123456);
+    benchmark::DoNotOptimize(out.len);
+    bytes += out.len;
+  }
+  state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_DrawReplyToCBOR)->Arg(1)->Arg(10)->Arg(78);
+
+// Added to every request and serial command
+void BM_LatencyHistogramRecord(benchmark::State& state) {
+  LatencyHistogram h;
+  uint32_t us = 1;
+  for (auto _ : state) {
+    h.record(us);
+    us = us * 3 % 2000003;
+  }
+  benchmark::DoNotOptimize(h.snapshot().count);
+}
+BENCHMARK(BM_LatencyHistogramRecord);
+
+void BM_FindSpread(benchmark::State& state) {
+  const char* names[] = {"single", "celtic", "zodiac", "unknown"};
+  int i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(&findSpread(names[i]));
+    i = (i + 1) & 3;
+  }
+}
+BENCHMARK(BM_FindSpread);
+
+void BM_ParseSerialCommand(benchmark::State& state) {
+  const char line[] = "#123456 SPREAD:celtic";
+  char buf[sizeof(line)];
+  for (auto _ : state) {
+    memcpy(buf, line, sizeof(line));
+    SerialCommand c = parseSerialCommand(buf);
+    benchmark::DoNotOptimize(c.id);
+  }
+}
+BENCHMARK(BM_ParseSerialCommand);
+
+// A scripted batch fed byte by byte through the line reader and split into commands
+void BM_SerialBatchLine(benchmark::State& state) {
+  const char input[] = "#1 DRAW;#2 SPREAD:three;#3 RANDOM:32,drbg;#4 PING\n";
+  SerialLineReader reader;
+  uint32_t ids = 0;
+  for (auto _ : state) {
+    for (const char* p = input; *p; p++) {
+      if (!reader.push(*p)) continue;
+      forEachSerialCommand(reader.line, [&](char* seg) {
+        ids += parseSerialCommand(seg).id;
+        return true;
+      });
+    }
+  }
+  benchmark::DoNotOptimize(ids);
+  state.SetItemsProcessed(state.iterations() * 4);
+}
+BENCHMARK(BM_SerialBatchLine);
+
+}  // namespace
+
+BENCHMARK_MAIN();
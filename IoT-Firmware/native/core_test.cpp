@@ -0,0 +1,848 @@
+// Unit tests for the firmware core (entropy_core.h, drbg.h, draw_json.h,
+// draw_cbor.h, event_stream.h, metrics.h, spreads.h, serial_command.h), built natively
+// against the shims in shim/.
+
+#include <Arduino.h>
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "draw_cbor.h"
+#include "draw_json.h"
+#include "drbg.h"
+#include "event_stream.h"
+#include "metrics.h"
+#include "serial_command.h"
+#include "spreads.h"
+#include "test_sources.h"
+
+namespace {
+
+// Fresh health state and a reproducible RNG for every test
+class CoreTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    nativeRandomSeed(1);
+    producerHealth = HealthTest();
+    healthState.store(HEALTH_OK);
+    healthTrips.store(0);
+  }
+
+  // A channel with a real ring of `words` entries (power of two)
+  void attachRing(EntropyChannel& ch, uint32_t words) {
+    ring.assign(words, 0);
+    ch.buf = ring.data();
+    ch.capacity = words;
+  }
+
+  std::vector<uint32_t> ring;
+};
+
+uint32_t stuckSource() { return 0x5A5A5A5A; }
+
+std::string render(const DrawReply& reply) {
+  JsonOut sizing(nullptr, 0);
+  reply.toJSON(sizing);
+  std::string s(sizing.pos, '\0');
+  JsonOut out(&s[0], s.size());
+  reply.toJSON(out);
+  return s;
+}
+
+// ---- Health tests ----
+
+TEST_F(CoreTest, HealthTestPassesRandomWords) {
+  HealthTest t;
+  for (int i = 0; i < 1000000; i++) ASSERT_TRUE(t.word(esp_random()));
+  EXPECT_EQ(t.rctFailures, 0u);
+  EXPECT_EQ(t.aptFailures, 0u);
+}
+
+TEST_F(CoreTest, HealthTestTripsOnStuckSource) {
+  HealthTest t;
+  bool ok = t.word(stuckSource());
+  ok &= t.word(stuckSource());
+  EXPECT_FALSE(ok);
+  EXPECT_GT(t.rctFailures, 0u);
+}
+
+TEST_F(CoreTest, FallbackTripFailsClosedAndFlushes) {
+  EntropyChannel ch;
+  attachRing(ch, 64);
+  EXPECT_EQ(refillChannel(ch), 64u);
+  EXPECT_TRUE(entropyHealthy(ch));
+
+  nativeRandomSource = stuckSource;
+  EXPECT_EQ(refillChannel(ch), 0u);  // ring is full, nothing sampled
+  ch.tail.store(ch.head.load());     // drain so reads fall back to the RNG
+  for (int i = 0; i < 4; i++) trngRead32(ch);
+  EXPECT_EQ(healthState.load(), HEALTH_FAILED);
+  EXPECT_FALSE(entropyHealthy(ch));
+  EXPECT_FALSE(entropyReady(ch));
+  EXPECT_EQ(ch.level(), 0u);
+  EXPECT_EQ(ch.bitReservoirCount, 0);
+}
+
+TEST_F(CoreTest, RefillNeverPublishesFailingBatch) {
+  EntropyChannel ch;
+  attachRing(ch, 128);
+  nativeRandomSource = stuckSource;
+  EXPECT_EQ(refillChannel(ch), 0u);
+  EXPECT_EQ(ch.level(), 0u);
+  EXPECT_EQ(healthState.load(), HEALTH_FAILED);
+}
+
+// ---- Channels and sampling ----
+
+TEST_F(CoreTest, ReadsComeFromRingUntilItRunsDry) {
+  EntropyChannel ch;
+  attachRing(ch, 64);
+  refillChannel(ch);
+  for (int i = 0; i < 64; i++) trngRead32(ch);
+  EXPECT_EQ(ch.underruns, 0u);
+  trngRead32(ch);
+  EXPECT_EQ(ch.underruns, 1u);
+  EXPECT_EQ(ch.wordsConsumed, 65u);
+}
+
+TEST_F(CoreTest, BitReservoirSplitsWords) {
+  EntropyChannel ch;
+  trngBits(ch, 16);
+  trngBits(ch, 16);
+  EXPECT_EQ(ch.wordsConsumed, 1u);
+  trngBits(ch, 24);
+  trngBits(ch, 8);
+  EXPECT_EQ(ch.wordsConsumed, 2u);
+}
+
+TEST_F(CoreTest, TrngFillMatchesRequestedLength) {
+  EntropyChannel ch;
+  attachRing(ch, 16);
+  refillChannel(ch);
+  uint8_t buf[103];
+  memset(buf, 0, sizeof(buf));
+  trngFill(ch, buf, sizeof(buf));
+  EXPECT_EQ(ch.level(), 0u);
+  EXPECT_EQ(ch.underruns, 1u);  // 64 bytes from the ring, 39 topped up directly
+}
+
+TEST_F(CoreTest, UnbiasedStaysInRange) {
+  EntropyChannel ch;
+  EXPECT_EQ(trngUnbiased(ch, 0), 0u);
+  EXPECT_EQ(trngUnbiased(ch, 1), 0u);
+  for (uint32_t range : {2u, 78u, 156u, 256u, 257u, 1000u, 0x80000001u}) {
+    for (int i = 0; i < 2000; i++) ASSERT_LT(trngUnbiased(ch, range), range);
+  }
+}
+
+TEST_F(CoreTest, UnbiasedIsUniformOver156Cells) {
+  EntropyChannel ch;
+  const int cells = 156, draws = 156 * 1000;
+  std::vector<int> counts(cells);
+  for (int i = 0; i < draws; i++) counts[trngUnbiased(ch, cells)]++;
+  double expected = (double)draws / cells, chi2 = 0;
+  for (int c : counts) chi2 += (c - expected) * (c - expected) / expected;
+  EXPECT_LT(chi2, 230.0);  // df 155, p ~ 1e-4
+}
+
+// ---- Source policies ----
+
+TEST_F(CoreTest, HardwareSourceTestsEveryWord) {
+  HardwareSource hw;
+  trngRead32(hw);
+  EXPECT_EQ(hw.wordsConsumed, 1u);
+  EXPECT_EQ(healthState.load(), HEALTH_OK);
+  nativeRandomSource = stuckSource;
+  uint8_t buf[16];
+  trngFill(hw, buf, sizeof(buf));
+  EXPECT_EQ(healthState.load(), HEALTH_FAILED);
+  EXPECT_GT(hw.health.rctFailures, 0u);
+}
+
+TEST_F(CoreTest, ScriptedSourceDrivesRejection) {
+  // Range 156 rejects 16-bit samples whose product's low half is under 16:
+  // the low half-word 0 is rejected, the high half-word 1 maps to card 0 upright
+  const uint32_t words[] = {0x00010000};
+  ScriptedSource src(words);
+  DrawResult r = drawSingleCard(src);
+  EXPECT_EQ(r.cardIndex, 0);
+  EXPECT_FALSE(r.isReversed);
+  EXPECT_EQ(src.wordsConsumed, 1u);
+  EXPECT_EQ(src.bitReservoirCount, 0);
+  EXPECT_EQ(src.unbiasedRetries, 1u);
+
+  // 0xFFFF * 156 >> 16 = 155: the last card, reversed
+  const uint32_t top[] = {0x0000FFFF};
+  ScriptedSource last(top);
+  r = drawSingleCard(last);
+  EXPECT_EQ(r.cardIndex, 77);
+  EXPECT_TRUE(r.isReversed);
+  EXPECT_EQ(last.unbiasedRetries, 0u);
+}
+
+TEST_F(CoreTest, SeededSourcesReproduceDraws) {
+  SplitMixSource a(42), b(42);
+  DrawReply ra, rb;
+  drawReplyFor(a, ra, 10, nullptr);
+  drawReplyFor(b, rb, 10, nullptr);
+  EXPECT_EQ(render(ra), render(rb));
+  EXPECT_EQ(a.cardsDrawn, 10u);
+  EXPECT_EQ(a.drawWords, a.wordsConsumed);
+}
+
+TEST_F(CoreTest, DefaultFillUsesNext) {
+  const uint32_t words[] = {0x04030201, 0x08070605};
+  ScriptedSource src(words);
+  uint8_t buf[6];
+  trngFill(src, buf, sizeof(buf));
+  const uint8_t expected[] = {1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(memcmp(buf, expected, sizeof(buf)), 0);
+  EXPECT_EQ(src.bytesFilled, 6u);
+}
+
+// ---- DRBG ----
+
+TEST_F(CoreTest, ChaCha20MatchesRfc8439) {
+  // RFC 8439 §2.3.2: key 00..1f, counter 1, nonce 00:00:00:09:00:00:00:4a:00:00:00:00
+  uint32_t key[8];
+  for (int i = 0; i < 8; i++) {
+    uint32_t b = (uint32_t)i * 4;
+    key[i] = b | (b + 1) << 8 | (b + 2) << 16 | (b + 3) << 24;
+  }
+  const uint32_t ctr[4] = {1, 0x09000000, 0x4a000000, 0};
+  uint32_t out[16];
+  chacha20Block(key, ctr, out);
+  const uint32_t expected[16] = {
+    0xe4e7f110, 0x15593bd1, 0x1fdd0f50, 0xc47120a3, 0xc7f4d1c7, 0x0368c033, 0x9aaa2204, 0x4e6cd4c3,
+    0x466482d2, 0x09aa9f07, 0x05d7c214, 0xa2028bd9, 0xd19c12b5, 0xb94e16de, 0xe883d0cb, 0x4e3c50a2
+  };
+  for (int i = 0; i < 16; i++) EXPECT_EQ(out[i], expected[i]) << "word " << i;
+}
+
+TEST_F(CoreTest, DrbgIsDeterministicPerSeed) {
+  SplitMixSource seedA(7), seedB(7), seedC(8);
+  DrbgSource<SplitMixSource> a(seedA), b(seedB), c(seedC);
+  bool differs = false;
+  for (int i = 0; i < 1000; i++) {
+    uint32_t va = trngRead32(a);
+    ASSERT_EQ(va, trngRead32(b));
+    differs |= va != trngRead32(c);
+  }
+  EXPECT_TRUE(differs);
+  EXPECT_EQ(seedA.wordsConsumed, (uint32_t)DRBG_KEY_WORDS);
+  EXPECT_EQ(a.reseeds, 1u);
+}
+
+TEST_F(CoreTest, DrbgFillMatchesWordStream) {
+  SplitMixSource seedA(3), seedB(3);
+  DrbgSource<SplitMixSource> a(seedA), b(seedB);
+  std::vector<uint8_t> bulk(2000);
+  trngFill(a, bulk.data(), bulk.size());
+  for (size_t i = 0; i < bulk.size(); i += 4) {
+    uint32_t w = trngRead32(b);
+    ASSERT_EQ(memcmp(&w, &bulk[i], 4), 0) << "offset " << i;
+  }
+  EXPECT_EQ(a.bytesGenerated, 2000u);
+}
+
+TEST_F(CoreTest, DrbgReseedsOnIntervalAndHealthTrip) {
+  SplitMixSource seed(1);
+  DrbgSource<SplitMixSource> drbg(seed);
+  drbg.reseedInterval = 960;  // two batches
+  uint8_t buf[480];
+  for (int i = 0; i < 4; i++) trngFill(drbg, buf, sizeof(buf));
+  EXPECT_EQ(drbg.reseeds, 2u);
+
+  healthTrip();
+  trngFill(drbg, buf, sizeof(buf));
+  EXPECT_EQ(drbg.reseeds, 3u);
+  EXPECT_EQ(seed.wordsConsumed, 3u * DRBG_KEY_WORDS);
+}
+
+TEST_F(CoreTest, DrbgOverChannelDrawsUniqueCards) {
+  EntropyChannel ch;
+  attachRing(ch, 64);
+  refillChannel(ch);
+  DrbgSource<EntropyChannel> drbg(ch);
+  DrawResult cards[TAROT_CARD_COUNT];
+  drawMultipleCards(drbg, cards, TAROT_CARD_COUNT);
+  std::set<int> seen;
+  for (const DrawResult& r : cards) seen.insert(r.cardIndex);
+  EXPECT_EQ(seen.size(), (size_t)TAROT_CARD_COUNT);
+  EXPECT_EQ(ch.wordsConsumed, (uint32_t)DRBG_KEY_WORDS);  // only the seed came from the channel
+  EXPECT_TRUE(entropyHealthy(ch));
+}
+
+// ---- Card draws ----
+
+TEST_F(CoreTest, DrawSingleCardCountsWords) {
+  EntropyChannel ch;
+  for (int i = 0; i < 100; i++) {
+    DrawResult r = drawSingleCard(ch);
+    ASSERT_LT(r.cardIndex, TAROT_CARD_COUNT);
+  }
+  EXPECT_EQ(ch.cardsDrawn, 100u);
+  EXPECT_EQ(ch.drawWords, ch.wordsConsumed);
+  EXPECT_LE(ch.wordsConsumed, 55u);  // ~0.5 words per card
+}
+
+// Chi-square over the 156 card/orientation cells, df 155: 230 is p ~ 1e-4,
+// and the seeded source keeps the outcome fixed from run to run
+double chiSquare156(const std::vector<int>& counts, int draws) {
+  double expected = (double)draws / counts.size(), chi2 = 0;
+  for (int c : counts) chi2 += (c - expected) * (c - expected) / expected;
+  return chi2;
+}
+
+TEST_F(CoreTest, DrawSingleCardIsUniformOver156Cells) {
+  SplitMixSource src(0x5EED);
+  const int draws = 156 * 1000;
+  std::vector<int> counts(156);
+  for (int i = 0; i < draws; i++) {
+    DrawResult r = drawSingleCard(src);
+    counts[r.cardIndex * 2 + r.isReversed]++;
+  }
+  EXPECT_LT(chiSquare156(counts, draws), 230.0);
+}
+
+// Every position of a spread must be uniform on its own, not just the deck as
+// a whole: a biased shuffle shows up as a skew at the first or last position
+TEST_F(CoreTest, DrawMultipleCardsIsUniformPerPosition) {
+  SplitMixSource src(0xC0FFEE);
+  const int spreads = 156 * 400, size = 10;
+  std::vector<std::vector<int>> counts(size, std::vector<int>(156));
+  DrawResult cards[size];
+  for (int i = 0; i < spreads; i++) {
+    drawMultipleCards(src, cards, size);
+    for (int p = 0; p < size; p++) counts[p][cards[p].cardIndex * 2 + cards[p].isReversed]++;
+  }
+  for (int p = 0; p < size; p++) EXPECT_LT(chiSquare156(counts[p], spreads), 230.0) << "position " << p;
+}
+
+TEST_F(CoreTest, DrawMultipleCardsAreUnique) {
+  EntropyChannel ch;
+  DrawResult cards[TAROT_CARD_COUNT];
+  drawMultipleCards(ch, cards, 200);  // clamped to a full deck
+  std::set<int> seen;
+  for (const DrawResult& r : cards) seen.insert(r.cardIndex);
+  EXPECT_EQ(seen.size(), (size_t)TAROT_CARD_COUNT);
+  EXPECT_EQ(ch.cardsDrawn, (uint32_t)TAROT_CARD_COUNT);
+}
+
+TEST_F(CoreTest, DrawCountLimits) {
+  EXPECT_TRUE(drawCountValid(1));
+  EXPECT_TRUE(drawCountValid(TAROT_CARD_COUNT));
+  EXPECT_FALSE(drawCountValid(0));   // also what toInt()/atol() make of "abc"
+  EXPECT_FALSE(drawCountValid(-3));
+  EXPECT_FALSE(drawCountValid(TAROT_CARD_COUNT + 1));
+  EXPECT_FALSE(drawCountValid(500));
+}
+
+TEST_F(CoreTest, DrawReplyClampsCount) {
+  EntropyChannel ch;
+  DrawReply reply;
+  drawReplyFor(ch, reply, 0, nullptr);
+  EXPECT_EQ(reply.count, 1);
+  drawReplyFor(ch, reply, 500, "x");
+  EXPECT_EQ(reply.count, TAROT_CARD_COUNT);
+  EXPECT_FALSE(reply.single);
+}
+
+// ---- JSON ----
+
+TEST_F(CoreTest, CardJSONIsPrecomputed) {
+  char buf[512];
+  JsonOut out(buf, sizeof(buf));
+  cardToJSON(out, DrawResult{0, true});
+  std::string s(buf, out.len);
+  EXPECT_EQ(s.rfind("{\"cardIndex\":0,\"name\":\"愚者\",\"nameEn\":\"The Fool\"", 0), 0u);
+  EXPECT_NE(s.find("\"isReversed\":true,\"orientation\":\"reversed\""), std::string::npos);
+  EXPECT_EQ(s.back(), '}');
+}
+
+TEST_F(CoreTest, DrawResultsJSONLayout) {
+  DrawResult cards[2] = {{1, false}, {77, true}};
+  char buf[2048];
+  JsonOut out(buf, sizeof(buf));
+  drawResultsToJSON(out, cards, 2, "三张牌阵");
+  std::string s(buf, out.len);
+  EXPECT_EQ(s.rfind("{\"spread\":\"三张牌阵\",\"count\":2,\"cards\":[{\"cardIndex\":1,", 0), 0u);
+  EXPECT_NE(s.find("},{\"cardIndex\":77,"), std::string::npos);
+  EXPECT_NE(s.find("],\"entropySource\":\"TRNG\",\"device\":\"ESP32\"}"), std::string::npos);
+
+  JsonOut plain(buf, sizeof(buf));
+  drawResultsToJSON(plain, cards, 2, nullptr);
+  EXPECT_EQ(std::string(buf, 21), "{\"count\":2,\"cards\":[{");
+}
+
+TEST_F(CoreTest, JsonOutWindowsMatchSinglePass) {
+  EntropyChannel ch;
+  DrawReply reply;
+  drawReplyFor(ch, reply, TAROT_CARD_COUNT, nullptr);
+  std::string whole = render(reply);
+  ASSERT_GT(whole.size(), (size_t)JSON_BUF_SIZE);
+
+  for (size_t window : {1u, 7u, 1436u, (unsigned)JSON_BUF_SIZE}) {
+    std::string joined;
+    std::vector<char> buf(window);
+    for (size_t sent = 0; sent < whole.size();) {
+      JsonOut out(buf.data(), window, sent);
+      reply.toJSON(out);
+      ASSERT_GT(out.len, 0u);
+      joined.append(buf.data(), out.len);
+      sent += out.len;
+    }
+    EXPECT_EQ(joined, whole) << "window " << window;
+  }
+}
+
+TEST_F(CoreTest, JsonOutWriteU32) {
+  char buf[32];
+  JsonOut out(buf, sizeof(buf));
+  out.writeU32(0);
+  out.write(',');
+  out.writeU32(4294967295u);
+  EXPECT_EQ(std::string(buf, out.len), "0,4294967295");
+}
+
+// ---- CBOR ----
+
+std::vector<uint8_t> bytesOf(const JsonOut& out) {
+  return std::vector<uint8_t>(out.buf, out.buf + out.len);
+}
+
+TEST_F(CoreTest, CborHeadUsesShortestArgument) {
+  char buf[8];
+  const std::pair<uint32_t, std::vector<uint8_t>> cases[] = {
+    {0, {0x00}}, {23, {0x17}}, {24, {0x18, 24}}, {255, {0x18, 0xFF}},
+    {256, {0x19, 0x01, 0x00}}, {65536, {0x1A, 0x00, 0x01, 0x00, 0x00}},
+  };
+  for (const auto& c : cases) {
+    JsonOut out(buf, sizeof(buf));
+    cborHead(out, CBOR_UINT, c.first);
+    EXPECT_EQ(bytesOf(out), c.second) << c.first;
+  }
+}
+
+TEST_F(CoreTest, CborSpreadCarriesIdAndCardCodes) {
+  DrawReply reply;
+  reply.count = 3;
+  reply.single = false;
+  reply.spreadName = "三张牌阵";
+  reply.spreadId = "three";
+  reply.cards[0] = {0, false};
+  reply.cards[1] = {11, true};
+  reply.cards[2] = {77, true};
+  char buf[64];
+  JsonOut out(buf, sizeof(buf));
+  drawReplyToCBOR(out, reply, true, 7);
+  const std::vector<uint8_t> expected = {
+    0xA4,                                   // map(4)
+    0x61, 'i', 0x07,                        // "i": 7
+    0x61, 's', 0x65, 't', 'h', 'r', 'e', 'e',  // "s": "three"
+    0x61, 'c', 0x83, 0x00, 0x17, 0x18, 155,  // "c": [0, 23, 155]
+    0x61, 'e', 0x64, 'T', 'R', 'N', 'G',    // "e": "TRNG"
+  };
+  EXPECT_EQ(bytesOf(out), expected);
+  EXPECT_LT(out.len, render(reply).size() / 20);
+}
+
+TEST_F(CoreTest, CborSingleDrawIsBareCode) {
+  DrawReply reply;
+  reply.count = 1;
+  reply.single = true;
+  reply.spreadName = nullptr;
+  reply.cards[0] = {40, true};
+  char buf[32];
+  JsonOut out(buf, sizeof(buf));
+  drawReplyToCBOR(out, reply);
+  const std::vector<uint8_t> expected = {0xA2, 0x61, 'c', 0x18, 81, 0x61, 'e', 0x64, 'T', 'R', 'N', 'G'};
+  EXPECT_EQ(bytesOf(out), expected);
+}
+
+TEST_F(CoreTest, CborRandomReplies) {
+  char buf[64];
+  JsonOut value(buf, sizeof(buf));
+  randomValueToCBOR(value, 0xDEADBEEF, "TRNG-DRBG");
+  const std::vector<uint8_t> v = {0xA2, 0x61, 'v', 0x1A, 0xDE, 0xAD, 0xBE, 0xEF,
+                                  0x61, 'e', 0x69, 'T', 'R', 'N', 'G', '-', 'D', 'R', 'B', 'G'};
+  EXPECT_EQ(bytesOf(value), v);
+
+  const uint8_t raw[3] = {1, 2, 3};
+  JsonOut bytes(buf, sizeof(buf));
+  randomBytesToCBOR(bytes, raw, sizeof(raw), "TRNG", true, 300);
+  const std::vector<uint8_t> b = {0xA3, 0x61, 'i', 0x19, 0x01, 0x2C, 0x61, 'b', 0x43, 1, 2, 3,
+                                  0x61, 'e', 0x64, 'T', 'R', 'N', 'G'};
+  EXPECT_EQ(bytesOf(bytes), b);
+}
+
+// ---- Seeds ----
+
+TEST_F(CoreTest, SeedRequestLimits) {
+  EXPECT_TRUE(seedRequestValid(32, 1));
+  EXPECT_TRUE(seedRequestValid(64, 128));
+  EXPECT_TRUE(seedRequestValid(256, 32));
+  EXPECT_FALSE(seedRequestValid(0, 1));
+  EXPECT_FALSE(seedRequestValid(48, 1));    // not a whole number of words
+  EXPECT_FALSE(seedRequestValid(512, 1));
+  EXPECT_FALSE(seedRequestValid(64, 0));
+  EXPECT_FALSE(seedRequestValid(256, 33));  // over SEED_MAX_BYTES
+}
+
+TEST_F(CoreTest, SeedReplyJSONAndCBOR) {
+  const uint32_t words[] = {0x04030201, 0x08070605, 0xDDCCBBAA};
+  ScriptedSource src(words);
+  SeedReply reply;
+  seedReplyFor(src, reply, 32, 3, "TRNG");
+  char buf[128];
+  JsonOut json(buf, sizeof(buf));
+  reply.toJSON(json);
+  EXPECT_EQ(std::string(buf, json.len),
+            "{\"bits\":32,\"seeds\":[\"01020304\",\"05060708\",\"aabbccdd\"],\"entropySource\":\"TRNG\"}");
+
+  JsonOut cbor(buf, sizeof(buf));
+  seedReplyToCBOR(cbor, reply, true, 7);
+  const std::vector<uint8_t> expected = {0xA4, 0x61, 'i', 0x07, 0x61, 'n', 0x18, 32, 0x61, 'd', 0x83,
+                                         0x44, 1, 2, 3, 4, 0x44, 5, 6, 7, 8, 0x44, 0xAA, 0xBB, 0xCC, 0xDD,
+                                         0x61, 'e', 0x64, 'T', 'R', 'N', 'G'};
+  EXPECT_EQ(bytesOf(cbor), expected);
+}
+
+TEST_F(CoreTest, SeedReplyFitsJsonBuffer) {
+  SplitMixSource src;
+  SeedReply reply;
+  seedReplyFor(src, reply, 32, SEED_MAX_BYTES / 4, "TRNG-DRBG");  // most seeds, most separators
+  JsonOut sizing(nullptr, 0);
+  reply.toJSON(sizing);
+  EXPECT_LT(sizing.pos, (size_t)JSON_BUF_SIZE);
+}
+
+// ---- Event stream ----
+
+// Everything fill() writes at time `now`, in windows of `window` bytes
+std::string drainStream(EntropyEventStream& s, uint32_t now, size_t window = 4096) {
+  std::string out;
+  std::vector<uint8_t> buf(window);
+  for (;;) {
+    size_t n = s.fill(buf.data(), window, now);
+    if (n == 0 || n == EVENT_STREAM_WAIT) return out;
+    out.append((const char*)buf.data(), n);
+  }
+}
+
+TEST_F(CoreTest, EventStreamPacesRandomBlocks) {
+  EntropyChannel ch;
+  EntropyEventStream s(ch, nullptr);
+  s.blockBytes = 4;
+  s.intervalMs = 100;
+  std::string first = drainStream(s, 1000);
+  ASSERT_EQ(first.size(), strlen("id: 1\nevent: random\ndata: 01234567\n\n"));
+  EXPECT_EQ(first.rfind("id: 1\nevent: random\ndata: ", 0), 0u);
+  EXPECT_EQ(first.substr(first.size() - 2), "\n\n");
+
+  uint8_t buf[64];
+  EXPECT_EQ(s.fill(buf, sizeof(buf), 1099), EVENT_STREAM_WAIT);  // next slot not due
+  EXPECT_EQ(drainStream(s, 1100).rfind("id: 2\n", 0), 0u);
+  // Three slots due at once are caught up within the lag allowance...
+  std::string burst = drainStream(s, 1400);
+  EXPECT_NE(burst.find("id: 5\n"), std::string::npos);
+  EXPECT_EQ(burst.find("id: 6\n"), std::string::npos);
+  // ...but a reader that stalls for seconds gets one event, not a backlog
+  EXPECT_EQ(drainStream(s, 9000).find("id: 7\n"), std::string::npos);
+  EXPECT_EQ(s.seq, 6u);
+}
+
+TEST_F(CoreTest, EventStreamWindowsAndLimit) {
+  EntropyChannel ch;
+  EntropyEventStream s(ch, nullptr);
+  s.kind = EntropyEventStream::DRAW;
+  s.drawCount = 3;
+  s.spreadName = "三张牌阵";
+  s.intervalMs = 0;
+  s.limited = true;
+  s.remaining = 2;
+  std::string joined = drainStream(s, 0, 7);
+  size_t second = joined.find("\n\nid: 2\n");
+  ASSERT_NE(second, std::string::npos);
+  EXPECT_EQ(joined.rfind("id: 1\nevent: draw\ndata: {\"spread\":\"三张牌阵\",\"count\":3,", 0), 0u);
+  EXPECT_EQ(joined.substr(joined.size() - 3), "}\n\n");
+  uint8_t buf[16];
+  EXPECT_EQ(s.fill(buf, sizeof(buf), 0), 0u);  // complete: the response ends
+}
+
+TEST_F(CoreTest, EventStreamHoldsWhileUnhealthy) {
+  EntropyChannel ch;
+  EntropyEventStream s(ch, nullptr);
+  healthState.store(HEALTH_FAILED);
+  uint8_t buf[128];
+  EXPECT_EQ(s.fill(buf, sizeof(buf), 0), EVENT_STREAM_WAIT);
+  EXPECT_EQ(s.seq, 0u);
+  healthState.store(HEALTH_OK);
+  EXPECT_NE(s.fill(buf, sizeof(buf), 0), EVENT_STREAM_WAIT);
+  EXPECT_EQ(s.seq, 1u);
+}
+
+TEST_F(CoreTest, EventStreamReadsDrbg) {
+  EntropyChannel ch;
+  DrbgSource<EntropyChannel> drbg(ch);
+  EntropyEventStream s(ch, &drbg);
+  s.blockBytes = 64;
+  drainStream(s, 0);
+  EXPECT_EQ(drbg.bytesGenerated, 64u);
+}
+
+TEST_F(CoreTest, DrbgDrawsAreLabelledDrbg) {
+  EntropyChannel ch;
+  DrbgSource<EntropyChannel> drbg(ch);
+  EntropyEventStream s(ch, &drbg);
+  s.kind = EntropyEventStream::DRAW;
+  s.drawCount = 3;
+  ASSERT_TRUE(s.nextEvent());
+  EXPECT_STREQ(s.reply.source, ENTROPY_SOURCE_DRBG);
+  EXPECT_NE(render(s.reply).find("\"entropySource\":\"TRNG-DRBG\""), std::string::npos);
+  char buf[64];
+  JsonOut out(buf, sizeof(buf));
+  drawReplyToCBOR(out, s.reply);
+  const std::string cbor(buf, out.len);
+  EXPECT_EQ(cbor.substr(cbor.size() - 12), std::string("\x61" "e" "\x69" "TRNG-DRBG"));
+
+  EntropyEventStream direct(ch, nullptr);
+  direct.kind = EntropyEventStream::DRAW;
+  ASSERT_TRUE(direct.nextEvent());
+  EXPECT_STREQ(direct.reply.source, ENTROPY_SOURCE_TRNG);
+}
+
+// ---- Metrics ----
+
+TEST(MetricsTest, HistogramBucketsAndWrappingSum) {
+  LatencyHistogram h;
+  h.record(0);
+  h.record(100);      // bounds are inclusive
+  h.record(101);
+  h.record(2000000);  // +Inf
+  HistogramCounts c = h.snapshot();
+  EXPECT_EQ(c.buckets[0], 2u);
+  EXPECT_EQ(c.buckets[1], 1u);
+  EXPECT_EQ(c.buckets[LATENCY_BUCKET_COUNT], 1u);
+  EXPECT_EQ(c.count, 4u);
+  EXPECT_EQ(c.sumUs, 2000201u);
+
+  h.record(0xFFFFFFFFu);
+  EXPECT_EQ(h.snapshot().sumUs, 2000201ull + 0xFFFFFFFFull);
+}
+
+TEST(MetricsTest, StatCountersCarryIntoHighWord) {
+  StatCounter c;
+  c++;
+  c += 41;
+  EXPECT_EQ(c.load(), 42u);
+
+  StatCounter64 total;
+  total += 0xFFFFFFF0u;
+  total += 0x20u;  // carries
+  EXPECT_EQ(total.load(), 0x100000010ull);
+  EXPECT_EQ(total.high.load() & 1, 0u);  // no carry left half-written
+  for (int i = 0; i < 3; i++) total += 0xFFFFFFFFu;
+  EXPECT_EQ(total.load(), 0x100000010ull + 3 * 0xFFFFFFFFull);
+}
+
+TEST(MetricsTest, SerialCommandSlots) {
+  EXPECT_EQ(metricSerialFor("DRAW"), METRIC_SERIAL_DRAW);
+  EXPECT_EQ(metricSerialFor("METRICS"), METRIC_SERIAL_METRICS);
+  EXPECT_EQ(metricSerialFor("draw"), METRIC_SERIAL_other);
+  EXPECT_EQ(metricSerialFor(""), METRIC_SERIAL_other);
+  EXPECT_STREQ(METRIC_ROUTE_LABELS[METRIC_ROUTE_seed], "/api/seed");
+}
+
+TEST_F(CoreTest, PrometheusLayoutAndWindows) {
+  MetricsRegistry registry;
+  registry.routes[METRIC_ROUTE_draw].record(300);
+  registry.routes[METRIC_ROUTE_draw].record(1234567);
+  EntropyChannel ch;  // no ring: every read is an underrun
+  DrbgSource<EntropyChannel> drbg(ch);
+  DrawReply reply;
+  drawReplyFor(ch, reply, 3, nullptr);
+  uint8_t block[64];
+  trngFill(drbg, block, sizeof(block));
+
+  static MetricsSnapshot m = {};
+  m.captureHistograms(registry);
+  m.channels[0] = channelCounters("http", ch, drbg);
+  m.channels[1] = channelCounters("serial", EntropyChannel(), drbg);
+  m.heapMinFree = 123456;
+  m.healthy = true;
+  JsonOut sizing(nullptr, 0);
+  m.toPrometheus(sizing);
+  std::string s(sizing.pos, '\0');
+  JsonOut out(&s[0], s.size());
+  m.toPrometheus(out);
+  EXPECT_NE(s.find("# TYPE trng_http_request_duration_seconds histogram\n"), std::string::npos);
+  EXPECT_NE(s.find("trng_http_request_duration_seconds_bucket{route=\"/api/draw\",le=\"0.00025\"} 0\n"), std::string::npos);
+  EXPECT_NE(s.find("trng_http_request_duration_seconds_bucket{route=\"/api/draw\",le=\"0.0005\"} 1\n"), std::string::npos);
+  EXPECT_NE(s.find("trng_http_request_duration_seconds_bucket{route=\"/api/draw\",le=\"+Inf\"} 2\n"), std::string::npos);
+  EXPECT_NE(s.find("trng_http_request_duration_seconds_sum{route=\"/api/draw\"} 1.234867\n"), std::string::npos);
+  EXPECT_NE(s.find("trng_http_request_duration_seconds_count{route=\"/api/draw\"} 2\n"), std::string::npos);
+  EXPECT_NE(s.find("trng_serial_command_duration_seconds_count{command=\"SEED\"} 0\n"), std::string::npos);
+  EXPECT_NE(s.find("trng_rng_words_consumed_total{channel=\"http\"} " + std::to_string(ch.wordsConsumed) + "\n"),
+            std::string::npos);
+  EXPECT_NE(s.find("trng_pool_underruns_total{channel=\"http\"} " + std::to_string(ch.underruns) + "\n"),
+            std::string::npos);
+  EXPECT_NE(s.find("trng_cards_drawn_total{channel=\"http\"} 3\n"), std::string::npos);
+  EXPECT_NE(s.find("trng_drbg_bytes_total{channel=\"http\"} 64\n"), std::string::npos);
+  EXPECT_NE(s.find("trng_cards_drawn_total{channel=\"serial\"} 0\n"), std::string::npos);
+  EXPECT_NE(s.find("trng_heap_min_free_bytes 123456\n"), std::string::npos);
+  EXPECT_NE(s.find("trng_healthy 1\n"), std::string::npos);
+  EXPECT_EQ(s.back(), '\n');
+
+  // Windowed regeneration, as the HTTP filler and METRICS do it
+  std::string windows;
+  char buf[1000];
+  for (size_t sent = 0; sent < s.size();) {
+    JsonOut w(buf, sizeof(buf), sent);
+    m.toPrometheus(w);
+    windows.append(buf, w.len);
+    sent += w.len;
+  }
+  EXPECT_EQ(windows, s);
+}
+
+// ---- Spreads ----
+
+TEST_F(CoreTest, FindSpreadByIdWithSingleFallback) {
+  EXPECT_EQ(findSpread("celtic").count, 10);
+  EXPECT_STREQ(findSpread("zodiac").nameEn, "Zodiac");
+  EXPECT_STREQ(findSpread("yes_no").id, "yes_no");
+  EXPECT_STREQ(findSpread("").id, "single");
+  EXPECT_STREQ(findSpread("CELTIC").id, "single");
+  for (const TarotSpread& sp : tarotSpreads) EXPECT_EQ(&findSpread(sp.id), &sp);
+}
+
+// ---- Serial command parser ----
+
+// parseSerialCommand tokenizes in place, so each case parses its own copy
+struct ParsedLine {
+  std::string text;
+  SerialCommand cmd;
+  explicit ParsedLine(const char* line) : text(line) { cmd = parseSerialCommand(&text[0]); }
+};
+
+TEST(SerialCommandTest, PlainCommands) {
+  ParsedLine l("  PING\r");
+  EXPECT_TRUE(l.cmd.valid);
+  EXPECT_FALSE(l.cmd.hasId);
+  EXPECT_TRUE(l.cmd.is("PING"));
+  EXPECT_FALSE(l.cmd.isWithArg("PING"));
+}
+
+TEST(SerialCommandTest, Arguments) {
+  ParsedLine spread("SPREAD: celtic ");
+  EXPECT_TRUE(spread.cmd.isWithArg("SPREAD"));
+  EXPECT_STREQ(spread.cmd.arg, "celtic");
+  EXPECT_FALSE(spread.cmd.is("SPREAD"));
+
+  ParsedLine bench("BENCH:100, 2000");
+  EXPECT_TRUE(bench.cmd.named("BENCH"));
+  char* draws = splitAt(bench.cmd.arg, ',');
+  EXPECT_STREQ(bench.cmd.arg, "100");
+  EXPECT_STREQ(draws, "2000");
+  EXPECT_EQ(splitAt(bench.cmd.arg, ','), nullptr);
+
+  ParsedLine empty("DRAW:");
+  EXPECT_TRUE(empty.cmd.isWithArg("DRAW"));
+  EXPECT_STREQ(empty.cmd.arg, "");
+}
+
+TEST(SerialCommandTest, RequestIds) {
+  ParsedLine draw("#42 DRAW:3");
+  EXPECT_TRUE(draw.cmd.valid);
+  EXPECT_TRUE(draw.cmd.hasId);
+  EXPECT_EQ(draw.cmd.id, 42u);
+  EXPECT_TRUE(draw.cmd.isWithArg("DRAW"));
+  EXPECT_STREQ(draw.cmd.arg, "3");
+
+  ParsedLine hello("#4294967295 \t HELLO");
+  EXPECT_EQ(hello.cmd.id, 4294967295u);
+  EXPECT_TRUE(hello.cmd.is("HELLO"));
+
+  ParsedLine bare("#7");
+  EXPECT_TRUE(bare.cmd.hasId);
+  EXPECT_STREQ(bare.cmd.name, "");
+}
+
+TEST(SerialCommandTest, BadRequestIds) {
+  for (const char* line : {"# DRAW", "#x DRAW", "#12a DRAW", "#-1 DRAW", "#4294967296 DRAW",
+                           "#00000000001 DRAW", "#"}) {
+    ParsedLine l(line);
+    EXPECT_FALSE(l.cmd.valid) << line;
+    EXPECT_FALSE(l.cmd.hasId) << line;
+    EXPECT_STREQ(l.cmd.name, "") << line;
+  }
+}
+
+TEST(SerialCommandTest, BatchesRunInOrder) {
+  std::string line = " DRAW ;SPREAD:three;; #9 RANDOM:16,drbg ;";
+  std::vector<std::string> seen;
+  forEachSerialCommand(&line[0], [&](char* seg) {
+    seen.push_back(seg);
+    return true;
+  });
+  ASSERT_EQ(seen.size(), 3u);
+  EXPECT_EQ(seen[0], "DRAW");
+  EXPECT_EQ(seen[1], "SPREAD:three");
+  EXPECT_EQ(seen[2], "#9 RANDOM:16,drbg");
+
+  std::string stop = "PING;STREAM;DRAW";
+  int count = 0;
+  forEachSerialCommand(&stop[0], [&](char* seg) {
+    count++;
+    return strcmp(seg, "STREAM") != 0;
+  });
+  EXPECT_EQ(count, 2);
+}
+
+TEST(SerialCommandTest, LineReaderAssemblesLines) {
+  SerialLineReader r;
+  std::vector<std::string> lines;
+  for (char c : std::string("\r\nPING\r\n\nDRAW;RANDOM\n")) {
+    if (r.push(c)) lines.push_back(r.line);
+  }
+  ASSERT_EQ(lines.size(), 2u);
+  EXPECT_EQ(lines[0], "PING");
+  EXPECT_EQ(lines[1], "DRAW;RANDOM");
+}
+
+TEST(SerialCommandTest, LineReaderFlagsOverlongLines) {
+  SerialLineReader r;
+  for (int i = 0; i < SERIAL_LINE_MAX + 100; i++) ASSERT_FALSE(r.push('A'));
+  ASSERT_TRUE(r.push('\n'));
+  EXPECT_TRUE(r.overflow);
+  EXPECT_EQ(strlen(r.line), (size_t)SERIAL_LINE_MAX);
+
+  for (char c : std::string("PING")) r.push(c);
+  ASSERT_TRUE(r.push('\n'));
+  EXPECT_FALSE(r.overflow);
+  EXPECT_STREQ(r.line, "PING");
+}
+
+TEST(SerialCommandTest, LineReaderResetDropsPartialLine) {
+  SerialLineReader r;
+  for (char c : std::string("\xF0\x0F garbage")) r.push(c);
+  r.reset();
+  for (char c : std::string("PING")) r.push(c);
+  ASSERT_TRUE(r.push('\n'));
+  EXPECT_STREQ(r.line, "PING");
+}
+
+TEST(SerialCommandTest, BaudRatesAreAscendingAndValidated) {
+  EXPECT_EQ(SERIAL_BAUD_RATES[0], 115200u);
+  for (size_t i = 1; i < SERIAL_BAUD_RATE_COUNT; i++) EXPECT_LT(SERIAL_BAUD_RATES[i - 1], SERIAL_BAUD_RATES[i]);
+  EXPECT_TRUE(serialBaudSupported(921600));
+  EXPECT_TRUE(serialBaudSupported(3000000));
+  EXPECT_FALSE(serialBaudSupported(9600));
+  EXPECT_FALSE(serialBaudSupported(1000000));
+  EXPECT_FALSE(serialBaudSupported(0));
+}
+
+}  // namespace
@@ -0,0 +1,15 @@
+/*
+ * Host stand-in for the parts of Arduino.h the firmware core uses: the C
+ * headers behind its fixed-width integer types and string functions. The
+ * serial parser (serial_command.h) works on plain char buffers, so no String
+ * stand-in is needed.
+ */
+
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#endif // NATIVE_ARDUINO_H
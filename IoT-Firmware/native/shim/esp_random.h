@@ -0,0 +1,49 @@
+/*
+ * Host stand-in for esp_random.h. The hardware RNG is replaced by a seedable
+ * SplitMix64 generator so tests and benchmarks are reproducible; tests can
+ * also install their own source (e.g. a stuck or biased one) to exercise the
+ * health tests.
+ */
+
+#ifndef NATIVE_ESP_RANDOM_H
+#define NATIVE_ESP_RANDOM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+inline uint64_t nativeRandomState = 0x9E3779B97F4A7C15ULL;
+
+inline uint32_t nativeSplitMix() {
+  uint64_t z = (nativeRandomState += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return (uint32_t)((z ^ (z >> 31)) >> 32);
+}
+
+inline uint32_t (*nativeRandomSource)() = nativeSplitMix;
+
+inline void nativeRandomSeed(uint64_t seed) {
+  nativeRandomState = seed;
+  nativeRandomSource = nativeSplitMix;
+}
+
+inline uint32_t esp_random() {
+  return nativeRandomSource();
+}
+
+inline void esp_fill_random(void* buf, size_t len) {
+  uint8_t* p = (uint8_t*)buf;
+  while (len >= 4) {
+    uint32_t w = esp_random();
+    memcpy(p, &w, 4);
+    p += 4;
+    len -= 4;
+  }
+  if (len > 0) {
+    uint32_t w = esp_random();
+    memcpy(p, &w, len);
+  }
+}
+
+#endif // NATIVE_ESP_RANDOM_H
@@ -0,0 +1,41 @@
+// Deterministic entropy-source policies for the native tests and benchmarks
+
+#ifndef NATIVE_TEST_SOURCES_H
+#define NATIVE_TEST_SOURCES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "entropy_core.h"
+
+// SplitMix64 with its own state, independent of the esp_random() shim
+struct SplitMixSource : EntropySource<SplitMixSource> {
+  uint64_t state;
+
+  explicit SplitMixSource(uint64_t seed = 1) : state(seed) {}
+
+  uint32_t next() {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return (uint32_t)((z ^ (z >> 31)) >> 32);
+  }
+};
+
+// Replays a fixed list of words, wrapping around at the end
+struct ScriptedSource : EntropySource<ScriptedSource> {
+  const uint32_t* words;
+  size_t count;
+  size_t pos = 0;
+
+  template <size_t N>
+  explicit ScriptedSource(const uint32_t (&w)[N]) : words(w), count(N) {}
+
+  uint32_t next() {
+    uint32_t w = words[pos % count];
+    pos++;
+    return w;
+  }
+};
+
+#endif // NATIVE_TEST_SOURCES_H
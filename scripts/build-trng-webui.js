@@ -0,0 +1,74 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * Copyright (c) 2026 B5-Software
+ *
+ * This file is part of Could I Be Your Partner.
+ *
+ * 生成 IoT-Firmware/CIBYP-TRNG/web_ui_gz.h：
+ * - 从 web_ui.h 的 R"rawliteral(...)rawliteral" 中取出 WebUI 页面
+ * - gzip（level 9）压缩后以 PROGMEM 字节数组写出，固件直接以 Content-Encoding: gzip 发送
+ * - 以页面内容的 SHA-1 生成强 ETag，浏览器重复访问时固件返回 304
+ * 修改 web_ui.h 后需重新运行：npm run build-trng-webui
+ */
+
+'use strict';
+
+const fs = require('fs');
+const path = require('path');
+const zlib = require('zlib');
+const crypto = require('crypto');
+
+const firmwareDir = path.resolve(__dirname, '..', 'IoT-Firmware', 'CIBYP-TRNG');
+const srcFile = path.join(firmwareDir, 'web_ui.h');
+const outFile = path.join(firmwareDir, 'web_ui_gz.h');
+
+function extractHTML(source) {
+  const start = source.indexOf('R"rawliteral(');
+  const end = source.indexOf(')rawliteral"');
+  if (start < 0 || end < start) throw new Error('web_ui.h 中未找到 rawliteral 页面');
+  return source.slice(start + 'R"rawliteral('.length, end);
+}
+
+// ETag 只取决于页面内容，与 zlib 版本无关
+function computeETag(html) {
+  return crypto.createHash('sha1').update(html, 'utf-8').digest('hex').slice(0, 16);
+}
+
+function renderHeader(html) {
+  const gz = zlib.gzipSync(Buffer.from(html, 'utf-8'), { level: 9 });
+  const etag = computeETag(html);
+  const rows = [];
+  for (let i = 0; i < gz.length; i += 16) {
+    rows.push('  ' + Array.from(gz.subarray(i, i + 16), b => '0x' + b.toString(16).padStart(2, '0')).join(', ') + ',');
+  }
+  return [
+    '/*',
+    ' * Gzip-compressed WebUI for CIBYP-IoT-TRNG',
+    ' * Auto-generated by scripts/build-trng-webui.js from web_ui.h - do not edit',
+    ` * ${Buffer.byteLength(html, 'utf-8')} bytes -> ${gz.length} bytes gzip`,
+    ' */',
+    '',
+    '#ifndef WEB_UI_GZ_H',
+    '#define WEB_UI_GZ_H',
+    '',
+    `#define WEB_UI_ETAG "\\"${etag}\\""`,
+    `#define WEB_UI_ETAG_GZIP "\\"${etag}-gz\\""`,
+    '',
+    `const size_t WEB_UI_GZ_LEN = ${gz.length};`,
+    'const uint8_t WEB_UI_GZ[] PROGMEM = {',
+    ...rows,
+    '};',
+    '',
+    '#endif // WEB_UI_GZ_H',
+    ''
+  ].join('\n');
+}
+
+function main() {
+  const html = extractHTML(fs.readFileSync(srcFile, 'utf-8'));
+  fs.writeFileSync(outFile, renderHeader(html), 'utf-8');
+  console.log(`[build-trng-webui] ETag ${computeETag(html)} -> ${path.relative(process.cwd(), outFile)}`);
+}
+
+if (require.main === module) main();
+module.exports = { extractHTML, computeETag, renderHeader, srcFile, outFile };
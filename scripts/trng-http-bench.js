@@ -0,0 +1,89 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * Copyright (c) 2026 B5-Software
+ *
+ * This file is part of Could I Be Your Partner.
+ *
+ * CIBYP-TRNG 固件 HTTP 并发延迟测试：
+ *   node scripts/trng-http-bench.js [--host 192.168.4.1] [--port 80]
+ *        [--path /api/spread?type=celtic] [--clients 8] [--requests 200]
+ * 以 --clients 个并发客户端（各自独立连接、不复用）共发出 --requests 个请求，
+ * 输出吞吐量与 p50 / p90 / p99 / max 延迟。
+ */
+
+'use strict';
+
+const http = require('http');
+
+function parseArgs(argv) {
+  const opts = { host: '192.168.4.1', port: 80, path: '/api/draw', clients: 8, requests: 200 };
+  for (let i = 0; i < argv.length; i += 2) {
+    const key = argv[i].replace(/^--/, '');
+    if (!(key in opts)) throw new Error(`未知参数: ${argv[i]}`);
+    opts[key] = typeof opts[key] === 'number' ? Number(argv[i + 1]) : argv[i + 1];
+  }
+  return opts;
+}
+
+function timedRequest(opts) {
+  return new Promise((resolve, reject) => {
+    const start = process.hrtime.bigint();
+    const req = http.get({ host: opts.host, port: opts.port, path: opts.path, agent: false }, (res) => {
+      res.on('data', () => {});
+      res.on('end', () => {
+        if (res.statusCode !== 200) return reject(new Error(`HTTP ${res.statusCode}`));
+        resolve(Number(process.hrtime.bigint() - start) / 1e6);
+      });
+    });
+    req.on('error', reject);
+    req.setTimeout(10000, () => req.destroy(new Error('请求超时')));
+  });
+}
+
+function percentile(sorted, p) {
+  if (!sorted.length) return 0;
+  return sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+}
+
+async function run(opts) {
+  const latencies = [];
+  let errors = 0;
+  let issued = 0;
+  const start = Date.now();
+  async function worker() {
+    while (issued < opts.requests) {
+      issued++;
+      try {
+        latencies.push(await timedRequest(opts));
+      } catch {
+        errors++;
+      }
+    }
+  }
+  await Promise.all(Array.from({ length: opts.clients }, worker));
+  const elapsed = (Date.now() - start) / 1000;
+  latencies.sort((a, b) => a - b);
+  return {
+    clients: opts.clients,
+    ok: latencies.length,
+    errors,
+    reqPerSec: latencies.length / elapsed,
+    p50: percentile(latencies, 0.5),
+    p90: percentile(latencies, 0.9),
+    p99: percentile(latencies, 0.99),
+    max: latencies.length ? latencies[latencies.length - 1] : 0
+  };
+}
+
+async function main() {
+  const opts = parseArgs(process.argv.slice(2));
+  console.log(`[trng-http-bench] http://${opts.host}:${opts.port}${opts.path}  clients=${opts.clients} requests=${opts.requests}`);
+  const r = await run(opts);
+  console.log(`  ok=${r.ok} errors=${r.errors} ${r.reqPerSec.toFixed(1)} req/s`);
+  console.log(`  latency ms: p50=${r.p50.toFixed(1)} p90=${r.p90.toFixed(1)} p99=${r.p99.toFixed(1)} max=${r.max.toFixed(1)}`);
+}
+
+if (require.main === module) {
+  main().catch((e) => { console.error('[trng-http-bench]', e.message); process.exit(1); });
+}
+module.exports = { run, parseArgs };
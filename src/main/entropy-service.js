@@ -0,0 +1,379 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * Copyright (c) 2026 B5-Software
+ *
+ * This file is part of Could I Be Your Partner.
+ *
+ * 主进程共享熵服务：塔罗抽牌、游戏种子等所有消费方统一从这里取随机字节。
+ *   - TRNG 模式：后台批量预取设备随机字节到有界缓冲区（网络模式优先订阅 /api/stream
+ *     推送流，旧固件退回 keep-alive 连接上的 /api/random?bytes=N；串口模式 RANDOM:<n>
+ *     走长期会话），低于低水位时自动补充；
+ *     抽牌直接从内存缓冲区取数，界面可见延迟与设备往返时间无关
+ *   - CSPRNG 模式：以 4 KB 为单位批量 randomFillSync，避免每次取数都调用 randomBytes
+ *   - 游戏种子：另设一小份 32 位整种子库存，由 /api/seed 或串口 SEED 一次批量取回，
+ *     开局直接出库、不等设备往返；旧固件没有 SEED 时改从上面的字节缓冲区取 4 字节
+ *   - 每次取数都返回来源（TRNG / CSPRNG），TRNG 缓冲区只存设备字节，不与 CSPRNG 混合；
+ *     设备不可达时 TRNG 取数抛出异常，由调用方决定是否回退并标注 entropySource
+ */
+
+'use strict';
+
+const crypto = require('crypto');
+const http = require('http');
+const { getSerialSession } = require('./trng-serial');
+const { TrngEventStream } = require('./trng-stream');
+
+const TRNG_BUFFER_CAPACITY = 4096;   // 预取缓冲区上限（字节）
+const TRNG_LOW_WATER = 1024;         // 低于此值时后台补充
+const TRNG_FETCH_CHUNK = 1024;       // 单次向设备请求的字节数（与固件 RANDOM_CHUNK_SIZE 一致）
+const TRNG_RETRY_BACKOFF_MS = 5000;  // 后台预取失败后的冷却时间
+const TRNG_FETCH_TIMEOUT_MS = 10000;
+const CSPRNG_POOL_SIZE = 4096;
+const SEED_BITS = 32;                // 游戏 PRNG 的种子宽度
+const SEED_STOCK = 16;               // 单次补货的种子数（固件 SEED 上限为 1024 字节）
+const SEED_LOW_WATER = 4;            // 库存低于此值时后台补货
+
+// 批量 CSPRNG：同步、进程内共享
+let csprngPool = Buffer.alloc(0);
+let csprngPos = 0;
+
+function csprngBytes(n) {
+  if (n > CSPRNG_POOL_SIZE) return crypto.randomBytes(n);
+  if (csprngPool.length - csprngPos < n) {
+    csprngPool = crypto.randomFillSync(Buffer.allocUnsafe(CSPRNG_POOL_SIZE));
+    csprngPos = 0;
+  }
+  const out = csprngPool.subarray(csprngPos, csprngPos + n);
+  csprngPos += n;
+  return Buffer.from(out);
+}
+
+// 从字节源取 [0, range) 的无偏整数（拒绝采样）：range ≤ 65536 时每次取 2 字节，否则 4 字节
+function uniformFromBytes(range, readBytes) {
+  const wide = range > 0x10000;
+  const space = wide ? 0x100000000 : 0x10000;
+  const limit = space - (space % range);
+  for (;;) {
+    const b = readBytes(wide ? 4 : 2);
+    const v = wide ? b.readUInt32BE(0) : b.readUInt16BE(0);
+    if (v < limit) return v % range;
+  }
+}
+
+function fetchNetworkBytes(host, port, count, agent) {
+  return new Promise((resolve, reject) => {
+    const req = http.get({ host, port, path: `/api/random?bytes=${count}`, agent }, (res) => {
+      const chunks = [];
+      res.on('data', (c) => chunks.push(c));
+      res.on('end', () => {
+        if (res.statusCode !== 200) return reject(new Error(`TRNG网络请求失败: HTTP ${res.statusCode}`));
+        resolve(Buffer.concat(chunks));
+      });
+      res.on('error', reject);
+    });
+    req.on('error', reject);
+    req.setTimeout(TRNG_FETCH_TIMEOUT_MS, () => req.destroy(new Error('TRNG网络请求超时')));
+  });
+}
+
+function fetchNetworkSeeds(host, port, bits, count, agent) {
+  return new Promise((resolve, reject) => {
+    const req = http.get({ host, port, path: `/api/seed?bits=${bits}&count=${count}`, agent }, (res) => {
+      const chunks = [];
+      res.on('data', (c) => chunks.push(c));
+      res.on('end', () => {
+        if (res.statusCode !== 200) {
+          const err = new Error(`TRNG种子请求失败: HTTP ${res.statusCode}`);
+          err.unsupported = res.statusCode === 404;
+          return reject(err);
+        }
+        try {
+          resolve(JSON.parse(Buffer.concat(chunks).toString('utf8')).seeds.map(h => Buffer.from(h, 'hex')));
+        } catch (e) {
+          reject(new Error('TRNG种子应答格式错误: ' + e.message));
+        }
+      });
+      res.on('error', reject);
+    });
+    req.on('error', reject);
+    req.setTimeout(TRNG_FETCH_TIMEOUT_MS, () => req.destroy(new Error('TRNG种子请求超时')));
+  });
+}
+
+async function fetchSerialSeeds(portPath, baud, bits, count) {
+  let json;
+  try {
+    json = await getSerialSession(portPath, baud).request(`SEED:${bits},${count}`);
+  } catch (e) {
+    if (/Unknown command/.test(e.message)) e.unsupported = true;
+    throw e;
+  }
+  if (!Array.isArray(json.seeds)) throw new Error('TRNG串口应答缺少 seeds 字段');
+  return json.seeds.map(s => (Buffer.isBuffer(s) ? s : Buffer.from(s, 'hex')));
+}
+
+async function fetchSerialBytes(portPath, baud, count) {
+  const json = await getSerialSession(portPath, baud).request(`RANDOM:${count}`);
+  if (Buffer.isBuffer(json.bytes)) return json.bytes; // CBOR 应答直接携带字节串
+  if (typeof json.bytes !== 'string') throw new Error('TRNG串口应答缺少 bytes 字段');
+  return Buffer.from(json.bytes, 'hex');
+}
+
+class EntropyService {
+  /**
+   * @param {object} [options]
+   * @param {Function} [options.fetchTrng] (entropy, count) => Promise<Buffer>（测试注入用）
+   * @param {Function} [options.fetchSeeds] (entropy, bits, count) => Promise<Buffer[]>（测试注入用）
+   * @param {number} [options.capacity]
+   * @param {number} [options.lowWater]
+   */
+  constructor(options = {}) {
+    this.capacity = options.capacity || TRNG_BUFFER_CAPACITY;
+    this.lowWater = options.lowWater ?? TRNG_LOW_WATER;
+    this.fetchTrng = options.fetchTrng || ((entropy, count) => this._fetchDevice(entropy, count));
+    this.fetchSeeds = options.fetchSeeds || ((entropy, bits, count) => this._fetchDeviceSeeds(entropy, bits, count));
+    this.agent = new http.Agent({ keepAlive: true, maxSockets: 2 });
+    this.stream = null;             // 网络模式的推送流（/api/stream）
+    this.streamUnsupported = false; // 设备固件不支持推送流时改用逐次请求
+    this.entropy = {};
+    this.configKey = '';
+    this.generation = 0;        // 设备配置变更时递增，丢弃旧设备在途预取的结果
+    this.chunks = [];           // 待取用的 TRNG 字节（Buffer 队列）
+    this.buffered = 0;
+    this.refilling = null;      // 在途预取 Promise
+    this.lastError = null;
+    this.retryAfter = 0;
+    this.seeds = [];            // 待出库的 TRNG 种子（uint32）
+    this.seedRefilling = null;
+    this.seedRetryAfter = 0;
+    this.seedUnsupported = false; // 设备固件没有 SEED / /api/seed
+    this.counters = { trngFetched: 0, trngServed: 0, csprngServed: 0, seedsFetched: 0, seedsServed: 0 };
+  }
+
+  get source() {
+    return this.entropy.source === 'trng' ? 'TRNG' : 'CSPRNG';
+  }
+
+  /**
+   * 应用 settings.entropy；设备参数变化时清空缓冲区。TRNG 模式下立即开始后台预取。
+   */
+  configure(entropy = {}) {
+    const e = { trngMode: 'network', trngSerialBaud: 115200, trngNetworkHost: '192.168.4.1', trngNetworkPort: 80, ...entropy };
+    const key = JSON.stringify([e.source, e.trngMode, e.trngSerialPort, e.trngSerialBaud, e.trngNetworkHost, e.trngNetworkPort]);
+    this.entropy = e;
+    if (key !== this.configKey) {
+      this.configKey = key;
+      this.generation++;
+      if (this.stream) this.stream.close();
+      this.stream = null;
+      this.streamUnsupported = false;
+      this.chunks = [];
+      this.buffered = 0;
+      this.refilling = null;
+      this.lastError = null;
+      this.retryAfter = 0;
+      this.seeds = [];
+      this.seedRefilling = null;
+      this.seedRetryAfter = 0;
+      this.seedUnsupported = false;
+    }
+    if (this.source === 'TRNG') {
+      this._maybeRefill();
+      this._maybeRefillSeeds();
+    }
+    return this;
+  }
+
+  /**
+   * 取 n 个随机字节，返回 { bytes, source }。
+   * TRNG 模式下缓冲区不足时等待一次预取；设备不可达则抛出异常（不静默混入 CSPRNG）。
+   */
+  async take(n) {
+    if (this.source !== 'TRNG') {
+      this.counters.csprngServed += n;
+      return { bytes: csprngBytes(n), source: 'CSPRNG' };
+    }
+    if (this.buffered < n) {
+      const generation = this.generation;
+      // 前台等待时不受后台失败冷却限制
+      while (this.buffered < n) {
+        await (this.refilling || this._refill(Math.max(n - this.buffered, TRNG_FETCH_CHUNK)));
+        if (generation !== this.generation) throw new Error('TRNG熵源配置已变更');
+        if (this.buffered < n && this.lastError) throw this.lastError;
+      }
+    }
+    const bytes = this._dequeue(n);
+    this.counters.trngServed += n;
+    this._maybeRefill();
+    return { bytes, source: 'TRNG' };
+  }
+
+  /** [0, range) 的无偏整数，返回 { value, source } */
+  async uniform(range) {
+    const wide = range > 0x10000;
+    const space = wide ? 0x100000000 : 0x10000;
+    const limit = space - (space % range);
+    for (;;) {
+      const { bytes, source } = await this.take(wide ? 4 : 2);
+      const v = wide ? bytes.readUInt32BE(0) : bytes.readUInt16BE(0);
+      if (v < limit) return { value: v % range, source };
+    }
+  }
+
+  /**
+   * 取一个 32 位游戏种子，返回 { seed, source }。TRNG 模式下优先从种子库存出库，
+   * 库存为空时等待一次补货；固件不支持 SEED 时取 4 个缓冲区字节，仍是完整的 TRNG 种子。
+   */
+  async takeSeed() {
+    if (this.source !== 'TRNG') {
+      this.counters.csprngServed += 4;
+      return { seed: csprngBytes(4).readUInt32BE(0), source: 'CSPRNG' };
+    }
+    if (this.seeds.length === 0 && !this.seedUnsupported) {
+      const generation = this.generation;
+      await (this.seedRefilling || this._refillSeeds());
+      if (generation !== this.generation) throw new Error('TRNG熵源配置已变更');
+    }
+    if (this.seeds.length === 0) {
+      const { bytes, source } = await this.take(4);
+      return { seed: bytes.readUInt32BE(0), source };
+    }
+    const seed = this.seeds.shift();
+    this.counters.seedsServed++;
+    this._maybeRefillSeeds();
+    return { seed, source: 'TRNG' };
+  }
+
+  stats() {
+    return {
+      source: this.source,
+      buffered: this.buffered,
+      capacity: this.capacity,
+      transport: this.stream && !this.stream.closed ? 'stream' : null,
+      seedStock: this.seeds.length,
+      ...this.counters,
+      lastError: this.lastError ? this.lastError.message : null
+    };
+  }
+
+  _dequeue(n) {
+    const out = Buffer.allocUnsafe(n);
+    let off = 0;
+    while (off < n) {
+      const head = this.chunks[0];
+      const take = Math.min(head.length, n - off);
+      head.copy(out, off, 0, take);
+      off += take;
+      if (take === head.length) this.chunks.shift();
+      else this.chunks[0] = head.subarray(take);
+    }
+    this.buffered -= n;
+    return out;
+  }
+
+  _maybeRefill() {
+    if (this.refilling || this.buffered >= this.lowWater) return;
+    if (Date.now() < this.retryAfter) return;
+    this._refill(TRNG_FETCH_CHUNK).catch(() => {});
+  }
+
+  // 连续预取直到缓冲区填满（或至少 minBytes），失败时记录错误并进入冷却
+  _refill(minBytes) {
+    const generation = this.generation;
+    const entropy = this.entropy;
+    this.refilling = (async () => {
+      try {
+        let fetched = 0;
+        while (generation === this.generation && (fetched < minBytes || this.buffered < this.capacity)) {
+          const want = Math.min(TRNG_FETCH_CHUNK, Math.max(this.capacity - this.buffered, minBytes - fetched));
+          const bytes = await this.fetchTrng(entropy, want);
+          if (generation !== this.generation) return;
+          if (!bytes || bytes.length === 0) throw new Error('TRNG设备返回空数据');
+          this.chunks.push(bytes);
+          this.buffered += bytes.length;
+          this.counters.trngFetched += bytes.length;
+          fetched += bytes.length;
+          this.lastError = null;
+        }
+      } catch (e) {
+        if (generation === this.generation) {
+          this.lastError = e;
+          this.retryAfter = Date.now() + TRNG_RETRY_BACKOFF_MS;
+        }
+      } finally {
+        if (generation === this.generation) this.refilling = null;
+      }
+    })();
+    return this.refilling;
+  }
+
+  _maybeRefillSeeds() {
+    if (this.seedRefilling || this.seedUnsupported || this.seeds.length >= SEED_LOW_WATER) return;
+    if (Date.now() < this.seedRetryAfter) return;
+    this._refillSeeds();
+  }
+
+  // 补一批种子；失败只进入冷却，出库时再退回字节缓冲区
+  _refillSeeds() {
+    const generation = this.generation;
+    const entropy = this.entropy;
+    this.seedRefilling = (async () => {
+      try {
+        const seeds = await this.fetchSeeds(entropy, SEED_BITS, SEED_STOCK);
+        if (generation !== this.generation) return;
+        for (const s of seeds) {
+          if (s.length !== SEED_BITS / 8) throw new Error('TRNG种子宽度不符');
+          this.seeds.push(s.readUInt32BE(0));
+        }
+        this.counters.seedsFetched += seeds.length;
+      } catch (e) {
+        if (generation !== this.generation) return;
+        if (e.unsupported) this.seedUnsupported = true;
+        else this.seedRetryAfter = Date.now() + TRNG_RETRY_BACKOFF_MS;
+      } finally {
+        if (generation === this.generation) this.seedRefilling = null;
+      }
+    })();
+    return this.seedRefilling;
+  }
+
+  _fetchDeviceSeeds(entropy, bits, count) {
+    if (entropy.trngMode === 'serial') {
+      return fetchSerialSeeds(entropy.trngSerialPort, entropy.trngSerialBaud || 115200, bits, count);
+    }
+    return fetchNetworkSeeds(entropy.trngNetworkHost || '192.168.4.1', entropy.trngNetworkPort || 80, bits, count, this.agent);
+  }
+
+  _fetchDevice(entropy, count) {
+    if (entropy.trngMode === 'serial') {
+      return fetchSerialBytes(entropy.trngSerialPort, entropy.trngSerialBaud || 115200, count);
+    }
+    const host = entropy.trngNetworkHost || '192.168.4.1';
+    const port = entropy.trngNetworkPort || 80;
+    if (this.streamUnsupported) return fetchNetworkBytes(host, port, count, this.agent);
+    if (!this.stream || this.stream.closed) this.stream = new TrngEventStream(host, port);
+    const stream = this.stream;
+    return stream.read(count).catch((e) => {
+      if (!stream.unsupported) throw e;
+      this.streamUnsupported = true;
+      return fetchNetworkBytes(host, port, count, this.agent);
+    });
+  }
+
+  /** 关闭推送流与 keep-alive 连接（进程退出、测试结束时调用） */
+  shutdown() {
+    if (this.stream) this.stream.close();
+    this.stream = null;
+    this.agent.destroy();
+  }
+}
+
+// 进程内共享实例：所有消费方共用一个预取缓冲区
+const entropyService = new EntropyService();
+
+module.exports = {
+  EntropyService,
+  entropyService,
+  csprngBytes,
+  uniformFromBytes
+};
@@ -41,6 +41,8 @@ const { createPresentation } = require('./ppt-maker');
 const { extractWordText, createWordDocument, fillWordTemplate, getWordMetadata, listWordStyles } = require('./word-tools');
 const mathTools = require('./math-tools');
 const tarotTools = require('./tarot-tools');
+const { closeAllSerialSessions } = require('./trng-serial');
+const { entropyService } = require('./entropy-service');
 const { decodeXmlEntities, encodeXmlEntities } = require('./xml-utils');
 const { recognizeImageWithTesseract } = require('./ocr');
 const sandboxRunner = require('./sandbox-runner');
@@ -1583,6 +1585,8 @@ ipcMain.handle('settings:set', (_, newSettings) => {
   const prevVoice = settings.voice ? JSON.parse(JSON.stringify(settings.voice)) : null;
   settings = { ...settings, ...newSettings };
   saveJSON(settingsPath, settings);
+  // 熵源设置变更：重建 TRNG 预取缓冲区
+  if (newSettings && newSettings.entropy) entropyService.configure(settings.entropy);
   // 广播主题/语言变化到所有窗口（主窗口 + 子窗口 CAD/EDA/小游戏）
   broadcastThemeChanged();
   broadcastSettingsChanged();
@@ -3130,7 +3134,8 @@ ipcMain.handle('trng:test', async () => {
     const source = settings.entropy?.source || 'csprng';
     if (source === 'trng') {
       const result = await tarotTools.drawTarotTRNG(settings.entropy || {});
-      return { ok: true, result };
+      const link = await tarotTools.getTrngLink(settings.entropy || {}).catch(() => null);
+      return { ok: true, result, link };
     }
     return { ok: true, result: tarotTools.drawTarotCSPRNG() };
   } catch (e) {
@@ -3147,13 +3152,9 @@ ipcMain.handle('game:trngGetSeed', async () => {
   const crypto = require('crypto');
   if (source === 'trng') {
     try {
-      const raw = await tarotTools.getTrngDraw(settings.entropy || {});
-      // Combine TRNG bits (8 bits: 7 from cardIndex + 1 from isReversed)
-      // with 24 bits of CSPRNG to produce a full 32-bit seed.
-      const cspNoise = crypto.randomBytes(3);
-      const trngByte = ((raw.cardIndex & 0x7F) | ((raw.isReversed ? 1 : 0) << 7)) & 0xFF;
-      const seed = ((trngByte << 24) | (cspNoise[0] << 16) | (cspNoise[1] << 8) | cspNoise[2]) >>> 0;
-      return { ok: true, seed, entropySource: 'TRNG' };
+      // 完整 32 位种子从共享熵服务的种子库存出库（设备 /api/seed 或 SEED 批量补货）
+      const { seed, source: entropySource } = await entropyService.configure(settings.entropy).takeSeed();
+      return { ok: true, seed, entropySource };
     } catch (e) {
       console.warn('[TRNG] game:trngGetSeed fallback to CSPRNG:', e.message);
       const seed = crypto.randomBytes(4).readUInt32BE(0);
@@ -6147,6 +6148,8 @@ app.whenReady().then(async () => {
   pluginManager.refreshAll().catch(e => console.warn('[DS Plugins] 启动加载失败:', e.message));
   // 启动自动化任务调度循环（cron / 通知 / HTTP 信号服务器）
   try { automationManager.start(); } catch (e) { console.warn('[automation] 启动失败:', e.message); }
+  // TRNG 熵源：启动即开始后台预取，首次抽牌无需等待设备往返
+  entropyService.configure(settings.entropy);
 
   // ---- Serial Port Agent Tools ----
   const agentSerialPorts = new Map(); // path → { port, buffer }
@@ -7466,6 +7469,9 @@ app.on('before-quit', async (event) => {
   }
   // 清理 Playwright 横幅窗口
   pwService._hidePwBanner();
+  // 释放 TRNG 串口会话与网络推送流
+  try { await closeAllSerialSessions(); } catch {}
+  try { entropyService.shutdown(); } catch {}
   // 关闭 aria2 子进程（保存会话以便下次恢复未完成下载）
   try { await aria2Manager.shutdown(); } catch {}
   // 清理托盘图标
@@ -12,17 +12,15 @@
 
 const tarotCards = require('../data/tarot.js');
 const tarotSpreads = require('../data/tarot-spreads.js');
+const { getSerialSession } = require('./trng-serial');
+const { decodeTrngReply } = require('./trng-cbor');
+const { entropyService, csprngBytes, uniformFromBytes } = require('./entropy-service');
 
 function drawTarotCSPRNG() {
-  const crypto = require('crypto');
-  const range = tarotCards.length;
-  const max = Math.floor(0x100000000 / range) * range;
-  let val;
-  do {
-    val = crypto.randomBytes(4).readUInt32BE(0);
-  } while (val >= max);
-  const card = tarotCards[val % range];
-  const isReversed = crypto.randomBytes(1)[0] < 128;
+  // 牌序号与正逆位合并为一次 [0, 156) 抽取
+  const val = csprngUniform(tarotCards.length * 2);
+  const card = tarotCards[val >> 1];
+  const isReversed = (val & 1) === 1;
   return {
     ...card,
     isReversed,
@@ -48,23 +46,47 @@ async function drawTarotTRNG(entropy = {}) {
   };
 }
 
+// [0, range) 的无偏 CSPRNG 整数（拒绝采样，字节取自批量 CSPRNG 池）
+function csprngUniform(range) {
+  return uniformFromBytes(range, csprngBytes);
+}
+
+// 部分 Fisher-Yates：从 [0, range) 中不重复地按序选出 count 个下标。
+// 第 i 步从剩余 range - i 个下标中均匀选一个，恰好 count 次有界抽取、无重试，
+// 每种有序选取结果的概率均为 (range - count)! / range!。与固件 drawMultipleCards 同一算法。
+function sampleUniqueIndices(range, count, uniform) {
+  const n = Math.min(count, range);
+  const deck = Array.from({ length: range }, (_, i) => i);
+  for (let i = 0; i < n; i++) {
+    const j = i + uniform(range - i);
+    const picked = deck[j];
+    deck[j] = deck[i];
+    deck[i] = picked;
+  }
+  return deck.slice(0, n);
+}
+
+// 同上，uniform 为异步（从熵服务的预取缓冲区取数）
+async function sampleUniqueIndicesAsync(range, count, uniform) {
+  const n = Math.min(count, range);
+  const deck = Array.from({ length: range }, (_, i) => i);
+  for (let i = 0; i < n; i++) {
+    const j = i + await uniform(range - i);
+    const picked = deck[j];
+    deck[j] = deck[i];
+    deck[i] = picked;
+  }
+  return deck.slice(0, n);
+}
+
 // Draw N cards using CSPRNG, ensuring no duplicates
 function drawTarotSpreadCSPRNG(count) {
-  const crypto = require('crypto');
-  const range = tarotCards.length;
-  const drawn = new Set();
   const cards = [];
-  while (cards.length < count && cards.length < range) {
-    const max = Math.floor(0x100000000 / range) * range;
-    let val;
-    do {
-      val = crypto.randomBytes(4).readUInt32BE(0);
-    } while (val >= max);
-    const idx = val % range;
-    if (drawn.has(idx)) continue;
-    drawn.add(idx);
+  const indices = sampleUniqueIndices(tarotCards.length, count, csprngUniform);
+  const orientation = csprngBytes(Math.ceil(indices.length / 8));
+  for (const [i, idx] of indices.entries()) {
     const card = tarotCards[idx];
-    const isReversed = crypto.randomBytes(1)[0] < 128;
+    const isReversed = ((orientation[i >> 3] >> (i & 7)) & 1) === 1;
     cards.push({
       ...card,
       isReversed,
@@ -78,42 +100,56 @@ function drawTarotSpreadCSPRNG(count) {
 }
 
 // Draw N cards using TRNG, ensuring no duplicates
+// 预取缓冲区（见 entropy-service.js）足够时直接在本地以同一部分 Fisher-Yates 抽取，无设备往返；
+// 缓冲区不足（冷启动、刚切换设备）时以一次 DRAW:N / /api/draw?count=N 往返由固件抽出 N 张不重复的牌，
+// 同时后台开始预取。设备不可达则抛出异常由调用方回退
 async function drawTarotSpreadTRNG(count, entropy = {}) {
+  const svc = entropyService.configure({ ...entropy, source: 'trng' });
+  const n = Math.min(count, tarotCards.length);
+  if (svc.buffered < n * 2 + Math.ceil(n / 8)) {
+    const raws = await getTrngSpread(entropy, n);
+    return raws.map(raw => trngCard(raw.cardIndex, raw.isReversed, 'TRNG'));
+  }
+  // 第 i 张牌由第 i 次有界抽取与朝向字节共同决定，标注取两者中较弱的熵源
+  const pickSources = [];
+  const indices = await sampleUniqueIndicesAsync(tarotCards.length, count, async (range) => {
+    const { value, source } = await svc.uniform(range);
+    pickSources.push(source);
+    return value;
+  });
+  const { bytes: orientation, source } = await svc.take(Math.ceil(indices.length / 8));
+  return indices.map((idx, i) => trngCard(idx, ((orientation[i >> 3] >> (i & 7)) & 1) === 1, weakerSource(pickSources[i], source)));
+}
+
+// 只有两份字节都取自 TRNG 才标注 TRNG，否则按 CSPRNG 标注
+function weakerSource(a, b) {
+  return a === b ? a : 'CSPRNG';
+}
+
+function trngCard(cardIndex, isReversed, entropySource) {
+  const card = tarotCards[cardIndex % tarotCards.length];
+  return {
+    ...card,
+    isReversed,
+    orientation: isReversed ? 'reversed' : 'upright',
+    meaningOfUpright: card.meaningOfUpright,
+    meaningOfReversed: card.meaningOfReversed,
+    entropySource
+  };
+}
+
+// 一次往返从设备取 count 张不重复的牌（唯一性由固件 drawMultipleCards 保证）
+async function getTrngSpread(entropy, count) {
   const mode = entropy.trngMode || 'network';
-  const drawn = new Set();
-  const cards = [];
-  for (let i = 0; i < count; i++) {
-    let raw;
-    if (mode === 'serial') {
-      raw = await getTRNGFromSerial(entropy.trngSerialPort, entropy.trngSerialBaud || 115200);
-    } else {
-      raw = await getTRNGFromNetwork(entropy.trngNetworkHost || '192.168.4.1', entropy.trngNetworkPort || 80);
-    }
-    let idx = raw.cardIndex % tarotCards.length;
-    // Avoid duplicates (try a few times)
-    let attempts = 0;
-    while (drawn.has(idx) && attempts < 5) {
-      if (mode === 'serial') {
-        raw = await getTRNGFromSerial(entropy.trngSerialPort, entropy.trngSerialBaud || 115200);
-      } else {
-        raw = await getTRNGFromNetwork(entropy.trngNetworkHost || '192.168.4.1', entropy.trngNetworkPort || 80);
-      }
-      idx = raw.cardIndex % tarotCards.length;
-      attempts++;
-    }
-    drawn.add(idx);
-    const card = tarotCards[idx];
-    const isReversed = raw.isReversed;
-    cards.push({
-      ...card,
-      isReversed,
-      orientation: isReversed ? 'reversed' : 'upright',
-      meaningOfUpright: card.meaningOfUpright,
-      meaningOfReversed: card.meaningOfReversed,
-      entropySource: 'TRNG'
-    });
+  const json = mode === 'serial'
+    ? await getSerialSession(entropy.trngSerialPort, entropy.trngSerialBaud || 115200).request(`DRAW:${count}`)
+    : await getTrngReply(entropy.trngNetworkHost || '192.168.4.1', entropy.trngNetworkPort || 80, `/api/draw?count=${count}`);
+  if (!Array.isArray(json.cards) || json.cards.length !== count) {
+    throw new Error(`TRNG设备返回的牌数不符（期望 ${count}，固件是否支持 count 参数？）`);
   }
-  return cards;
+  const raws = json.cards.map(c => ({ cardIndex: c.cardIndex, isReversed: c.isReversed }));
+  if (new Set(raws.map(r => r.cardIndex)).size !== raws.length) throw new Error('TRNG设备返回了重复的牌');
+  return raws;
 }
 
 // 根据 entropy 配置从 TRNG 设备取一次原始抽取结果（串口或网络）
@@ -125,97 +161,46 @@ async function getTrngDraw(entropy = {}) {
   return getTRNGFromNetwork(entropy.trngNetworkHost || '192.168.4.1', entropy.trngNetworkPort || 80);
 }
 
+// 经长期保持的串口会话抽一张牌；并发调用在同一连接上流水线发出（见 trng-serial.js）
 async function getTRNGFromSerial(portPath, baud) {
-  return new Promise((resolve, reject) => {
-    if (!portPath) return reject(new Error('未配置TRNG串口'));
-    let { SerialPort } = {};
-    try { ({ SerialPort } = require('serialport')); } catch {
-      return reject(new Error('serialport 模块未安装，请运行 npm install serialport'));
-    }
-
-    const port = new SerialPort({ path: portPath, baudRate: baud });
-    let responded = false;
-
-    function safeClose() {
-      try { if (port.isOpen) port.close(); } catch {}
-    }
-
-    const globalTimeout = setTimeout(() => {
-      safeClose();
-      if (!responded) { responded = true; reject(new Error('TRNG串口超时')); }
-    }, 12000);
-
-    port.on('error', (e) => {
-      clearTimeout(globalTimeout);
-      if (!responded) { responded = true; reject(e); }
-    });
-
-    port.once('open', () => {
-      // --- Phase 1: flush phase ---
-      // Discard ALL data received in the first 600 ms.
-      // This eliminates the ESP32/Arduino bootloader startup log that sits in
-      // the OS USB-CDC buffer and would otherwise cause a parse failure.
-      let flushing = true;
-      let responseBuf = '';
-
-      port.on('data', (chunk) => {
-        if (flushing) return; // silently discard startup-log bytes
-
-        responseBuf += chunk.toString();
-        // Look for complete JSON line (device sends one JSON object per line)
-        const lines = responseBuf.split('\n');
-        for (const line of lines) {
-          const trimmed = line.trim();
-          if (trimmed.startsWith('{') && trimmed.endsWith('}')) {
-            clearTimeout(globalTimeout);
-            safeClose();
-            try {
-              const json = JSON.parse(trimmed);
-              if (!responded) {
-                responded = true;
-                resolve({ cardIndex: json.cardIndex, isReversed: json.isReversed });
-              }
-            } catch (e) {
-              if (!responded) {
-                responded = true;
-                reject(new Error('TRNG串口JSON解析失败: ' + trimmed));
-              }
-            }
-            return;
-          }
-        }
-      });
+  const json = await getSerialSession(portPath, baud).request('DRAW');
+  return { cardIndex: json.cardIndex, isReversed: json.isReversed };
+}
 
-      // --- Phase 2: after flush window, send command ---
-      setTimeout(() => {
-        flushing = false;
-        responseBuf = '';
-        port.write('DRAW\n', (err) => {
-          if (err && !responded) {
-            clearTimeout(globalTimeout);
-            responded = true;
-            safeClose();
-            reject(new Error('TRNG串口写入失败: ' + err.message));
-          }
-        });
-      }, 600); // 600 ms is enough for typical ESP32 boot log to drain
-    });
-  });
+// 串口模式下返回会话协商后的链路信息 { link, baud, maxBaud, chip }；网络模式返回 null
+async function getTrngLink(entropy = {}) {
+  if ((entropy.trngMode || 'network') !== 'serial') return null;
+  const session = getSerialSession(entropy.trngSerialPort, entropy.trngSerialBaud || 115200);
+  await session.open();
+  return session.linkInfo();
 }
 
 async function getTRNGFromNetwork(host, port) {
+  const json = await getTrngReply(host, port, '/api/draw');
+  return { cardIndex: json.cardIndex, isReversed: json.isReversed };
+}
+
+// 请求紧凑的 CBOR 应答（固件 draw_cbor.h）；旧固件忽略 Accept 头仍返回 JSON，按 Content-Type 解码
+function getTrngReply(host, port, urlPath) {
   const http = require('http');
   return new Promise((resolve, reject) => {
     const timeout = setTimeout(() => reject(new Error('TRNG网络超时')), 10000);
-    const req = http.get(`http://${host}:${port}/api/draw`, (res) => {
-      let data = '';
-      res.on('data', (chunk) => data += chunk);
+    const req = http.get(`http://${host}:${port}${urlPath}`, { headers: { Accept: 'application/cbor, application/json' } }, (res) => {
+      const chunks = [];
+      res.on('data', (chunk) => chunks.push(chunk));
       res.on('end', () => {
         clearTimeout(timeout);
+        const data = Buffer.concat(chunks);
+        const cbor = (res.headers['content-type'] || '').startsWith('application/cbor');
+        let json;
         try {
-          const json = JSON.parse(data);
-          resolve({ cardIndex: json.cardIndex, isReversed: json.isReversed });
-        } catch (e) { reject(new Error('TRNG网络数据解析失败: ' + data)); }
+          json = cbor ? decodeTrngReply(data) : JSON.parse(data.toString('utf8'));
+        } catch (e) { return reject(new Error('TRNG网络数据解析失败: ' + (cbor ? e.message : data.toString('utf8')))); }
+        // 固件健康检测未通过时返回 503 {"ok":false,"error":...}，不得当作抽牌结果
+        if (res.statusCode !== 200 || json.ok === false) {
+          return reject(new Error('TRNG设备错误: ' + (json.error || `HTTP ${res.statusCode}`)));
+        }
+        resolve(json);
       });
     });
     req.on('error', (e) => { clearTimeout(timeout); reject(e); });
@@ -230,7 +215,11 @@ module.exports = {
   drawTarotTRNG,
   drawTarotSpreadCSPRNG,
   drawTarotSpreadTRNG,
+  sampleUniqueIndices,
+  sampleUniqueIndicesAsync,
   getTrngDraw,
+  getTrngSpread,
   getTRNGFromSerial,
-  getTRNGFromNetwork
+  getTRNGFromNetwork,
+  getTrngLink
 };
@@ -0,0 +1,106 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * Copyright (c) 2026 B5-Software
+ *
+ * This file is part of Could I Be Your Partner.
+ *
+ * CIBYP-TRNG 紧凑应答（CBOR，RFC 8949）解码：
+ *   - 固件只发送牌序号、正逆位与牌阵 id（见固件 draw_cbor.h），牌名与释义由主机
+ *     src/data/tarot.js 的同一张 78 张牌表补全；十张牌的牌阵约 40 字节
+ *   - decodeCbor 只实现固件用到的子集：无符号整数、字节串、文本串、数组、映射、
+ *     false / true / null
+ *   - decodeTrngReply 把单字母键映射回与 JSON 应答相同的字段名，调用方无需区分格式：
+ *       "c" 单个牌码 → { cardIndex, isReversed }
+ *       "c" 牌码数组 → { count, cards: [{ cardIndex, isReversed }] }（"s" → spreadId）
+ *       "v" → value，"b" → bytes（Buffer），"e" → entropySource，"i" → id
+ *       "n" → bits，"d" → seeds（Buffer 数组，JSON 应答中为十六进制字符串）
+ *     牌码 = cardIndex * 2 + isReversed
+ */
+
+'use strict';
+
+function decodeCbor(buf) {
+  let pos = 0;
+
+  function need(n) {
+    if (pos + n > buf.length) throw new Error('CBOR数据不完整');
+  }
+
+  function readArg(info) {
+    if (info < 24) return info;
+    const size = { 24: 1, 25: 2, 26: 4 }[info];
+    if (!size) throw new Error(`不支持的CBOR长度编码: ${info}`);
+    need(size);
+    const v = buf.readUIntBE(pos, size);
+    pos += size;
+    return v;
+  }
+
+  function item() {
+    need(1);
+    const initial = buf[pos++];
+    const major = initial >> 5;
+    const info = initial & 0x1f;
+    if (major === 7) {
+      if (info === 20) return false;
+      if (info === 21) return true;
+      if (info === 22) return null;
+      throw new Error(`不支持的CBOR简单值: ${info}`);
+    }
+    const arg = readArg(info);
+    switch (major) {
+      case 0: return arg;
+      case 2:
+      case 3: {
+        need(arg);
+        const bytes = buf.subarray(pos, pos + arg);
+        pos += arg;
+        return major === 2 ? Buffer.from(bytes) : bytes.toString('utf8');
+      }
+      case 4: return Array.from({ length: arg }, item);
+      case 5: {
+        const map = {};
+        for (let i = 0; i < arg; i++) {
+          const key = item();
+          map[key] = item();
+        }
+        return map;
+      }
+      default: throw new Error(`不支持的CBOR类型: ${major}`);
+    }
+  }
+
+  const value = item();
+  if (pos !== buf.length) throw new Error('CBOR数据末尾有多余字节');
+  return value;
+}
+
+function decodeCard(code) {
+  if (!Number.isInteger(code) || code < 0 || code >= 156) throw new Error(`无效的牌码: ${code}`);
+  return { cardIndex: code >> 1, isReversed: (code & 1) === 1 };
+}
+
+function decodeTrngReply(buf) {
+  const m = decodeCbor(buf);
+  if (!m || typeof m !== 'object' || Array.isArray(m)) throw new Error('CBOR应答不是映射');
+  const out = {};
+  if (m.i !== undefined) out.id = m.i;
+  if (m.s !== undefined) out.spreadId = m.s;
+  if (Array.isArray(m.c)) {
+    out.count = m.c.length;
+    out.cards = m.c.map(decodeCard);
+  } else if (m.c !== undefined) {
+    Object.assign(out, decodeCard(m.c));
+  }
+  if (m.v !== undefined) out.value = m.v;
+  if (m.b !== undefined) out.bytes = m.b;
+  if (m.n !== undefined) out.bits = m.n;
+  if (m.d !== undefined) out.seeds = m.d;
+  if (m.e !== undefined) out.entropySource = m.e;
+  return out;
+}
+
+module.exports = {
+  decodeCbor,
+  decodeTrngReply
+};
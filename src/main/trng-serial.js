@@ -0,0 +1,427 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * Copyright (c) 2026 B5-Software
+ *
+ * This file is part of Could I Be Your Partner.
+ *
+ * CIBYP-TRNG 串口会话：长期保持设备串口打开，多个调用方并发复用同一连接。
+ *   - 打开串口后发送 "#0 HELLO" 握手，丢弃握手应答之前的一切输出（开机日志），
+ *     取代此前每次请求固定等待 600 ms 的清空窗口
+ *   - 每条命令带请求号 "#<id> <CMD>"，固件在应答 JSON 中回显 "id"，
+ *     据此把应答分发给对应调用方；命令可流水线式连续发出，无需等待上一条应答
+ *   - 握手后协商链路速率（协议版本 ≥ 2）：UART 桥接时从高到低逐级发送 BAUD:<n>，
+ *     设备先以原速率应答再切换，本端随之切换并以 PING 确认；确认失败则退回原速率、
+ *     等设备确认窗口过去后再试下一档。原生 USB-CDC 链路不受波特率限制，不做协商
+ *   - 每个串口路径记住上次成功的速率与失败过的速率（模块级，随进程存续），
+ *     重新打开时先试上次成功的速率、不再重试失败过的档位，免去每次数秒的逐档协商
+ *   - 固件只在复位时回到开机速率：关闭会话前先以 BAUD 把链路退回开机速率并确认；
+ *     若设备仍停在别的速率（上次异常退出、桥接芯片不随 DTR 复位开发板），
+ *     握手在开机速率下无应答一段时间后轮流以固件支持的各档速率发送 HELLO
+ *   - 协议版本 ≥ 3 时发送 FMT:CBOR：抽牌、牌阵与随机数应答改为 CBOR 帧
+ *     （0xC0 + u16 小端长度 + 载荷，见 trng-cbor.js），其余应答仍为 JSON 行
+ *   - 空闲一段时间后自动关闭串口；出错或断开时拒绝所有在途请求，下次调用重新打开
+ */
+
+'use strict';
+
+const { decodeTrngReply } = require('./trng-cbor');
+
+const SESSION_IDLE_CLOSE_MS = 30000;   // 空闲多久后释放串口
+const HELLO_RETRY_MS = 250;            // 握手重发间隔（设备可能因 DTR 复位而仍在启动）
+const HELLO_TIMEOUT_MS = 6000;
+const REQUEST_TIMEOUT_MS = 5000;
+const MAX_LINE_LENGTH = 16384;         // 超长无换行数据视为噪声丢弃
+const CBOR_FRAME = 0xC0;               // 固件 SERIAL_CBOR_FRAME，UTF-8 中不会出现
+const BAUD_CANDIDATES = [3000000, 2000000, 1500000, 921600, 460800, 230400]; // 固件 SERIAL_BAUD_RATES，从高到低尝试
+const BAUD_PROBE_AFTER_MS = 1500;      // 开机速率下握手无应答多久后开始轮询其它速率（留出开机日志时间）
+const BAUD_SETTLE_MS = 20;             // 本端切换后留给设备发完应答、完成切换的时间
+const BAUD_CONFIRM_TIMEOUT_MS = 300;   // 新速率下 PING 的应答时限
+const BAUD_REVERT_MARGIN_MS = 200;     // 确认失败后，在设备确认窗口之外再多等的时间
+
+class TrngSerialSession {
+  /**
+   * @param {string} portPath
+   * @param {number} baud
+   * @param {object} [options]
+   * @param {Function} [options.createPort] (path, baud) => 类 SerialPort 对象（测试注入用）
+   * @param {number} [options.idleCloseMs]
+   * @param {boolean} [options.negotiate] 握手后是否协商更高波特率（默认 true）
+   * @param {number} [options.maxBaud] 协商上限（默认 3000000）
+   * @param {number} [options.baudSettleMs]
+   * @param {number} [options.baudConfirmTimeoutMs]
+   * @param {number} [options.baudRevertMarginMs]
+   * @param {number} [options.baudProbeAfterMs]
+   * @param {Map} [options.linkCache] 串口路径 -> { good, failed } 速率记录（测试注入用）
+   * @param {string} [options.format] 'cbor'（默认，固件支持时启用）或 'json'
+   */
+  constructor(portPath, baud, options = {}) {
+    this.portPath = portPath;
+    this.baud = baud;
+    this.createPort = options.createPort || defaultCreatePort;
+    this.idleCloseMs = options.idleCloseMs ?? SESSION_IDLE_CLOSE_MS;
+    this.negotiate = options.negotiate ?? true;
+    this.maxBaud = options.maxBaud || BAUD_CANDIDATES[0];
+    this.baudSettleMs = options.baudSettleMs ?? BAUD_SETTLE_MS;
+    this.baudConfirmTimeoutMs = options.baudConfirmTimeoutMs ?? BAUD_CONFIRM_TIMEOUT_MS;
+    this.baudRevertMarginMs = options.baudRevertMarginMs ?? BAUD_REVERT_MARGIN_MS;
+    this.baudProbeAfterMs = options.baudProbeAfterMs ?? BAUD_PROBE_AFTER_MS;
+    this.preferredFormat = options.format || 'cbor';
+    this.linkCache = options.linkCache || linkCache;
+    this.port = null;
+    this.ready = null;          // 握手完成的 Promise
+    this.after = null;          // 同一串口上一个会话的关闭 Promise，打开前先等它释放端口
+    this.settled = false;       // 握手、协商与格式选择均已完成
+    this.closing = null;        // shutdown() 进行中的 Promise
+    this.hello = null;          // 握手应答（协议版本、芯片型号等）
+    this.link = null;           // 'uart' | 'usb-cdc'
+    this.linkBaud = baud;       // 协商后的实际波特率
+    this.format = 'json';       // 当前应答格式：'json' | 'cbor'
+    this.pending = new Map();   // id -> { resolve, reject, timer }
+    this.nextId = 1;
+    this.rxBuf = Buffer.alloc(0);
+    this.idleTimer = null;
+    this.closed = false;
+  }
+
+  open() {
+    if (this.ready) return this.ready;
+    this.ready = Promise.resolve(this.after).then(() => this._handshake()).then(async (hello) => {
+      try {
+        await this._negotiate(hello);
+        await this._selectFormat(hello);
+      } catch (e) {
+        const err = new Error('TRNG串口速率协商失败: ' + e.message);
+        this.close(err);
+        throw err;
+      }
+      this.settled = true;
+      return hello;
+    });
+    this.ready.catch(() => {});
+    return this.ready;
+  }
+
+  _handshake() {
+    return new Promise((resolve, reject) => {
+      let port;
+      try {
+        port = this.createPort(this.portPath, this.baud);
+      } catch (e) {
+        return reject(e);
+      }
+      this.port = port;
+      let answered = false;
+      const deadline = setTimeout(() => {
+        answered = true;
+        this.pending.delete(0);
+        const err = new Error('TRNG串口握手超时（固件是否支持 HELLO？）');
+        reject(err);
+        this.close(err);
+      }, HELLO_TIMEOUT_MS);
+
+      // 握手占用请求号 0；收到应答前的所有行（开机日志、旧命令的残留应答）都被忽略
+      this.pending.set(0, {
+        resolve: (json) => {
+          clearTimeout(deadline);
+          answered = true;
+          this.hello = json;
+          resolve(json);
+        },
+        reject: (e) => {
+          clearTimeout(deadline);
+          answered = true;
+          reject(e);
+        },
+        timer: null
+      });
+
+      port.on('data', (chunk) => this._onData(chunk));
+      port.on('error', (e) => this.close(e));
+      port.on('close', () => this.close(new Error('TRNG串口已断开')));
+
+      // 先以开机速率重发（设备可能因 DTR 复位而仍在启动），之后每次重发换一档速率；
+      // 应答以哪一档到达，设备就停在哪一档
+      const rates = this._probeRates();
+      const start = async () => {
+        const started = Date.now();
+        for (let i = 0; !answered && !this.closed; i++) {
+          if (rates.length > 1 && Date.now() - started >= this.baudProbeAfterMs) {
+            const rate = rates[i % rates.length];
+            if (rate !== this.linkBaud) {
+              try { await this._setPortBaud(rate); } catch { break; }
+              this.linkBaud = rate;
+              this.rxBuf = Buffer.alloc(0);
+              if (answered) break;
+            }
+          }
+          // 前导换行结束设备侧可能残留的半行输入
+          try { port.write('\n#0 HELLO\n'); } catch {}
+          await delay(HELLO_RETRY_MS);
+        }
+      };
+      if (port.isOpen) start();
+      else port.once('open', start);
+    });
+  }
+
+  // 握手轮询的速率：开机速率在前，其次是该串口上次成功的速率，其余按固件速率表从低到高
+  _probeRates() {
+    if (!this.negotiate || typeof this.port.update !== 'function') return [this.baud];
+    const good = this._linkRecord().good;
+    const rates = BAUD_CANDIDATES.filter(rate => rate !== this.baud && rate !== good && rate <= this.maxBaud).reverse();
+    return good && good !== this.baud && good <= this.maxBaud ? [this.baud, good, ...rates] : [this.baud, ...rates];
+  }
+
+  _linkRecord() {
+    let record = this.linkCache.get(this.portPath);
+    if (!record) {
+      record = { good: 0, failed: new Set() };
+      this.linkCache.set(this.portPath, record);
+    }
+    return record;
+  }
+
+  // 从高到低逐档尝试，停在设备与桥接芯片都能稳定工作的最高速率；
+  // 上次成功的速率优先，失败过的档位不再尝试
+  async _negotiate(hello) {
+    this.link = hello.link || 'uart';
+    if (!this.negotiate || !(hello.proto >= 2) || this.link !== 'uart') return;
+    if (typeof this.port.update !== 'function') return;
+    const record = this._linkRecord();
+    const ceiling = Math.min(this.maxBaud, hello.maxBaud || this.baud);
+    const usable = (rate) => rate > this.linkBaud && rate <= ceiling && !record.failed.has(rate);
+    const order = BAUD_CANDIDATES.filter(usable);
+    if (usable(record.good)) order.unshift(...order.splice(order.indexOf(record.good), 1));
+    for (const rate of order) {
+      if (await this._tryBaud(rate)) {
+        record.good = rate;
+        return;
+      }
+      record.failed.add(rate);
+      if (record.good === rate) record.good = 0;
+    }
+    if (this.linkBaud !== this.baud) record.good = this.linkBaud;
+  }
+
+  // 先应答、后切换：BAUD 应答以原速率到达，之后双方切到新速率并用 PING 确认
+  async _tryBaud(rate) {
+    const previous = this.linkBaud;
+    let confirmMs = 0;
+    try {
+      const ack = await this._send(`BAUD:${rate}`);
+      if (ack.baud !== rate) return false;
+      confirmMs = ack.confirmMs || 0;
+      await this._setPortBaud(rate);
+      await delay(this.baudSettleMs);
+      this.rxBuf = Buffer.alloc(0);
+      await this._send('PING', this.baudConfirmTimeoutMs);
+      this.linkBaud = rate;
+      return true;
+    } catch (e) {
+      if (this.closed) throw e;
+      // 设备未收到确认时会在 confirmMs 后自行退回原速率；等它退回后用原速率验证连通
+      await this._setPortBaud(previous);
+      await delay(confirmMs + this.baudRevertMarginMs);
+      this.rxBuf = Buffer.alloc(0);
+      await this._send('PING');
+      return false;
+    }
+  }
+
+  // 关闭前把链路退回开机速率，与协商同样先应答、后切换，再以 PING 确认
+  async _restoreBaud() {
+    const ack = await this._send(`BAUD:${this.baud}`, this.baudConfirmTimeoutMs);
+    if (ack.baud !== this.baud) return;
+    await this._setPortBaud(this.baud);
+    this.linkBaud = this.baud;
+    await delay(this.baudSettleMs);
+    this.rxBuf = Buffer.alloc(0);
+    await this._send('PING', this.baudConfirmTimeoutMs);
+  }
+
+  async _selectFormat(hello) {
+    if (this.preferredFormat !== 'cbor' || !(hello.proto >= 3)) return;
+    const ack = await this._send('FMT:CBOR');
+    if (ack.format === 'cbor') this.format = 'cbor';
+  }
+
+  _setPortBaud(baudRate) {
+    return new Promise((resolve, reject) => {
+      this.port.update({ baudRate }, (err) => (err ? reject(err) : resolve()));
+    });
+  }
+
+  /** 当前链路信息：{ link, baud, format, maxBaud, chip } */
+  linkInfo() {
+    return {
+      link: this.link,
+      baud: this.linkBaud,
+      format: this.format,
+      maxBaud: this.hello ? this.hello.maxBaud || null : null,
+      chip: this.hello ? this.hello.chip || null : null
+    };
+  }
+
+  /**
+   * 发送一条命令，返回其 JSON 应答。可并发调用，命令按调用顺序流水线发出。
+   * @param {string} command 例如 'DRAW'、'SPREAD:celtic'
+   */
+  async request(command, timeoutMs = REQUEST_TIMEOUT_MS) {
+    await this.open();
+    return this._send(command, timeoutMs);
+  }
+
+  _send(command, timeoutMs = REQUEST_TIMEOUT_MS) {
+    if (this.closed) return Promise.reject(new Error('TRNG串口已关闭'));
+    const id = this.nextId;
+    this.nextId = this.nextId >= 0xFFFFFFFF ? 1 : this.nextId + 1;
+    this._touch();
+    return new Promise((resolve, reject) => {
+      const timer = setTimeout(() => {
+        this.pending.delete(id);
+        reject(new Error('TRNG串口超时'));
+      }, timeoutMs);
+      this.pending.set(id, { resolve, reject, timer });
+      this.port.write(`#${id} ${command}\n`, (err) => {
+        if (!err) return;
+        clearTimeout(timer);
+        this.pending.delete(id);
+        reject(new Error('TRNG串口写入失败: ' + err.message));
+      });
+    });
+  }
+
+  // 按字节处理：CBOR 帧以 0xC0 开头，其余按换行切分为 JSON 行
+  _onData(chunk) {
+    this.rxBuf = this.rxBuf.length ? Buffer.concat([this.rxBuf, chunk]) : chunk;
+    for (;;) {
+      if (this.format === 'cbor' && this.rxBuf[0] === CBOR_FRAME) {
+        if (this.rxBuf.length < 3) break;
+        const end = 3 + this.rxBuf.readUInt16LE(1);
+        if (this.rxBuf.length < end) break;
+        const frame = this.rxBuf.subarray(3, end);
+        this.rxBuf = this.rxBuf.subarray(end);
+        this._onFrame(frame);
+        continue;
+      }
+      const nl = this.rxBuf.indexOf(0x0a);
+      if (nl < 0) break;
+      const line = this.rxBuf.subarray(0, nl).toString('utf8').trim();
+      this.rxBuf = this.rxBuf.subarray(nl + 1);
+      this._onLine(line);
+    }
+    if (this.rxBuf.length > MAX_LINE_LENGTH) this.rxBuf = Buffer.alloc(0);
+  }
+
+  _onFrame(frame) {
+    let reply;
+    try { reply = decodeTrngReply(frame); } catch { return; }
+    this._dispatch(reply);
+  }
+
+  _onLine(line) {
+    if (!line.startsWith('{') || !line.endsWith('}')) return;
+    let json;
+    try { json = JSON.parse(line); } catch { return; }
+    this._dispatch(json);
+  }
+
+  _dispatch(json) {
+    if (typeof json.id !== 'number') return; // 非本会话的应答（如旧格式输出）
+    const entry = this.pending.get(json.id);
+    if (!entry) return;
+    this.pending.delete(json.id);
+    if (entry.timer) clearTimeout(entry.timer);
+    delete json.id;
+    if (json.error) entry.reject(new Error('TRNG设备错误: ' + json.error));
+    else entry.resolve(json);
+    this._touch();
+  }
+
+  _touch() {
+    if (this.idleTimer) clearTimeout(this.idleTimer);
+    if (!this.idleCloseMs) return;
+    this.idleTimer = setTimeout(() => {
+      if (this.pending.size === 0) this.shutdown();
+      else this._touch();
+    }, this.idleCloseMs);
+    if (this.idleTimer.unref) this.idleTimer.unref();
+  }
+
+  /**
+   * 正常关闭：链路不在开机速率时先退回，再关闭串口。退回失败不影响关闭，
+   * 下次打开时由握手轮询找回设备所在的速率
+   */
+  shutdown(reason) {
+    if (this.closed) return Promise.resolve();
+    if (!this.closing) {
+      this.closing = (async () => {
+        if (this.settled && this.link === 'uart' && this.linkBaud !== this.baud) {
+          try { await this._restoreBaud(); } catch {}
+        }
+        this.close(reason);
+      })();
+    }
+    return this.closing;
+  }
+
+  close(reason) {
+    if (this.closed) return;
+    this.closed = true;
+    if (this.idleTimer) clearTimeout(this.idleTimer);
+    const err = reason || new Error('TRNG串口已关闭');
+    for (const entry of this.pending.values()) {
+      if (entry.timer) clearTimeout(entry.timer);
+      entry.reject(err);
+    }
+    this.pending.clear();
+    try { if (this.port && this.port.isOpen) this.port.close(); } catch {}
+    if (this.onClose) this.onClose();
+  }
+}
+
+function delay(ms) {
+  return new Promise((resolve) => setTimeout(resolve, ms));
+}
+
+function defaultCreatePort(portPath, baud) {
+  let SerialPort;
+  try { ({ SerialPort } = require('serialport')); } catch {
+    throw new Error('serialport 模块未安装，请运行 npm install serialport');
+  }
+  return new SerialPort({ path: portPath, baudRate: baud });
+}
+
+// 每个串口路径一个会话；会话关闭后从表中移除，下次调用时重新打开
+const sessions = new Map();
+// 每个串口路径的速率记录，会话关闭后保留，供下次打开时跳过协商
+const linkCache = new Map();
+
+function getSerialSession(portPath, baud, options) {
+  if (!portPath) throw new Error('未配置TRNG串口');
+  const key = `${portPath}@${baud}`;
+  let session = sessions.get(key);
+  if (session && !session.closed) return session;
+  // 同一串口换了波特率：先释放旧会话占用的端口
+  const released = [];
+  for (const other of [...sessions.values()]) {
+    if (other.portPath === portPath) released.push(other.shutdown());
+  }
+  session = new TrngSerialSession(portPath, baud, options);
+  if (released.length) session.after = Promise.all(released);
+  session.onClose = () => { if (sessions.get(key) === session) sessions.delete(key); };
+  sessions.set(key, session);
+  return session;
+}
+
+async function closeAllSerialSessions() {
+  const all = [...sessions.values()];
+  sessions.clear();
+  await Promise.all(all.map(session => session.shutdown()));
+}
+
+module.exports = {
+  TrngSerialSession,
+  getSerialSession,
+  closeAllSerialSessions
+};
@@ -0,0 +1,162 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ * Copyright (c) 2026 B5-Software
+ *
+ * This file is part of Could I Be Your Partner.
+ *
+ * CIBYP-TRNG 推送熵流客户端（GET /api/stream，Server-Sent Events）：
+ *   - 一条长连接持续接收设备按 rate 推送的 random 事件（十六进制字节块），
+ *     取数时直接读本地队列，不再为每批字节单独发起 HTTP 请求
+ *   - 流量控制：队列达到高水位时暂停读取响应，TCP 背压使设备停止生成；
+ *     取走数据、低于高水位后恢复
+ *   - 旧固件（404）标记为 unsupported，由调用方退回 /api/random?bytes=N
+ *   - 空闲一段时间无人取数时断开，设备随之释放该流
+ */
+
+'use strict';
+
+const http = require('http');
+
+const STREAM_BLOCK_BYTES = 1024;     // 每个事件的字节数（固件上限 1024）
+const STREAM_RATE = 20;              // 每秒事件数（固件上限 100）
+const STREAM_HIGH_WATER = 4096;      // 本地队列高水位（字节）
+const STREAM_IDLE_CLOSE_MS = 30000;
+const STREAM_READ_TIMEOUT_MS = 10000;
+
+class TrngEventStream {
+  /**
+   * @param {string} host
+   * @param {number} port
+   * @param {object} [options]
+   * @param {number} [options.bytes] 每个事件的字节数
+   * @param {number} [options.rate] 每秒事件数
+   * @param {number} [options.highWater]
+   * @param {number} [options.idleCloseMs]
+   */
+  constructor(host, port, options = {}) {
+    this.host = host;
+    this.port = port;
+    this.bytes = options.bytes || STREAM_BLOCK_BYTES;
+    this.rate = options.rate || STREAM_RATE;
+    this.highWater = options.highWater || STREAM_HIGH_WATER;
+    this.idleCloseMs = options.idleCloseMs ?? STREAM_IDLE_CLOSE_MS;
+    this.req = null;
+    this.res = null;
+    this.text = '';
+    this.chunks = [];           // 已收到、尚未取走的字节（Buffer 队列）
+    this.queued = 0;
+    this.waiters = [];          // { resolve, reject, count, timer }
+    this.idleTimer = null;
+    this.closed = false;
+    this.unsupported = false;   // 设备固件没有 /api/stream
+    this.eventsReceived = 0;
+  }
+
+  _connect() {
+    if (this.req) return;
+    const path = `/api/stream?kind=random&bytes=${this.bytes}&rate=${this.rate}`;
+    this.req = http.get({ host: this.host, port: this.port, path, agent: false }, (res) => {
+      if (res.statusCode !== 200) {
+        this.unsupported = res.statusCode === 404;
+        res.resume();
+        return this.close(new Error(`TRNG推送流不可用: HTTP ${res.statusCode}`));
+      }
+      this.res = res;
+      res.setEncoding('utf8');
+      res.on('data', (text) => this._onText(text));
+      res.on('end', () => this.close(new Error('TRNG推送流已结束')));
+      res.on('error', (e) => this.close(e));
+    });
+    this.req.on('error', (e) => this.close(e));
+  }
+
+  _onText(text) {
+    this.text += text;
+    let end;
+    while ((end = this.text.indexOf('\n\n')) >= 0) {
+      const block = this.text.slice(0, end);
+      this.text = this.text.slice(end + 2);
+      let event = 'message';
+      let data = '';
+      for (const line of block.split('\n')) {
+        const colon = line.indexOf(':');
+        if (colon <= 0) continue; // 空行或注释行
+        const field = line.slice(0, colon);
+        const value = line.slice(colon + 1).replace(/^ /, '');
+        if (field === 'event') event = value;
+        else if (field === 'data') data += value;
+      }
+      if (event === 'random' && data) {
+        const bytes = Buffer.from(data, 'hex');
+        this.chunks.push(bytes);
+        this.queued += bytes.length;
+        this.eventsReceived++;
+      }
+    }
+    if (this.queued >= this.highWater && this.res && !this.res.isPaused()) this.res.pause();
+    this._serveWaiters();
+  }
+
+  /** 取至多 count 字节（至少 1 字节）；队列为空时等待下一个事件 */
+  read(count) {
+    if (this.closed) return Promise.reject(new Error('TRNG推送流已关闭'));
+    this._touch();
+    this._connect();
+    return new Promise((resolve, reject) => {
+      const timer = setTimeout(() => {
+        this.waiters = this.waiters.filter(w => w.resolve !== resolve);
+        reject(new Error('TRNG推送流超时'));
+      }, STREAM_READ_TIMEOUT_MS);
+      this.waiters.push({ resolve, reject, count, timer });
+      this._serveWaiters();
+    });
+  }
+
+  _serveWaiters() {
+    while (this.waiters.length && this.queued > 0) {
+      const w = this.waiters.shift();
+      clearTimeout(w.timer);
+      w.resolve(this._dequeue(Math.min(w.count, this.queued)));
+    }
+    if (this.queued < this.highWater && this.res && this.res.isPaused()) this.res.resume();
+  }
+
+  _dequeue(n) {
+    const out = Buffer.allocUnsafe(n);
+    let off = 0;
+    while (off < n) {
+      const head = this.chunks[0];
+      const take = Math.min(head.length, n - off);
+      head.copy(out, off, 0, take);
+      off += take;
+      if (take === head.length) this.chunks.shift();
+      else this.chunks[0] = head.subarray(take);
+    }
+    this.queued -= n;
+    return out;
+  }
+
+  _touch() {
+    if (this.idleTimer) clearTimeout(this.idleTimer);
+    if (!this.idleCloseMs) return;
+    this.idleTimer = setTimeout(() => this.close(), this.idleCloseMs);
+    if (this.idleTimer.unref) this.idleTimer.unref();
+  }
+
+  close(reason) {
+    if (this.closed) return;
+    this.closed = true;
+    if (this.idleTimer) clearTimeout(this.idleTimer);
+    const err = reason || new Error('TRNG推送流已关闭');
+    for (const w of this.waiters) {
+      clearTimeout(w.timer);
+      w.reject(err);
+    }
+    this.waiters = [];
+    if (this.req) this.req.destroy();
+  }
+}
+
+module.exports = {
+  TrngEventStream
+};
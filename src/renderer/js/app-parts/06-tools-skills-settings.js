@@ -4551,7 +4551,8 @@
         const r = result.result;
         const _lang3 = (typeof i18nGetLanguage === 'function' ? i18nGetLanguage() : 'zh-CN');
         const _isZh3 = (_lang3 === 'zh-CN');
-        el.textContent = `${_isZh3 ? '连接成功! 抽到: ' : 'Connected! Drew: '}${r.name}${r.orientation === 'reversed' ? ' (Reversed)' : ' (Upright)'} - ${r.entropySource}`;
+        const link = result.link ? ` · ${result.link.link === 'usb-cdc' ? 'USB-CDC' : `UART ${result.link.baud} baud`}` : '';
+        el.textContent = `${_isZh3 ? '连接成功! 抽到: ' : 'Connected! Drew: '}${r.name}${r.orientation === 'reversed' ? ' (Reversed)' : ' (Upright)'} - ${r.entropySource}${link}`;
         el.className = 'setting-hint success';
       } else {
         el.textContent = `连接失败: ${result.error}`;
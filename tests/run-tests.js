@@ -75,6 +75,514 @@ test('minor arcana should have 4 suits with 14 cards each', () => {
   }
 });
 
+// ---- Test Tarot Tools ----
+console.log('\nTarot Tools:');
+const tarotTools = require('../src/main/tarot-tools.js');
+
+// 可复现的种子 PRNG（mulberry32），仅用于分布测试
+function seededUniform(seed) {
+  let a = seed >>> 0;
+  return (range) => {
+    a = (a + 0x6D2B79F5) >>> 0;
+    let t = a;
+    t = Math.imul(t ^ (t >>> 15), t | 1);
+    t ^= t + Math.imul(t ^ (t >>> 7), t | 61);
+    const u = ((t ^ (t >>> 14)) >>> 0) / 4294967296;
+    return Math.floor(u * range);
+  };
+}
+
+test('sampleUniqueIndices maps every draw sequence to a distinct ordered selection', () => {
+  // range=5, count=3：5*4*3 = 60 种抽取序列应一一对应 60 种有序选取（精确均匀）
+  const seen = new Set();
+  for (let a = 0; a < 5; a++) {
+    for (let b = 0; b < 4; b++) {
+      for (let c = 0; c < 3; c++) {
+        const script = [a, b, c];
+        let k = 0;
+        const picked = tarotTools.sampleUniqueIndices(5, 3, () => script[k++]);
+        assert.strictEqual(k, 3, 'should make exactly count draws');
+        assert.strictEqual(new Set(picked).size, 3, 'picks must be unique');
+        seen.add(picked.join(','));
+      }
+    }
+  }
+  assert.strictEqual(seen.size, 60);
+});
+
+test('sampleUniqueIndices draws are uniform per position (chi-square)', () => {
+  const uniform = seededUniform(0xC1B7);
+  const trials = 20000;
+  const first = new Array(78).fill(0);
+  const last = new Array(78).fill(0);
+  for (let t = 0; t < trials; t++) {
+    const picked = tarotTools.sampleUniqueIndices(78, 12, uniform);
+    assert.strictEqual(new Set(picked).size, 12);
+    first[picked[0]]++;
+    last[picked[11]]++;
+  }
+  const expected = trials / 78;
+  const chi2 = (counts) => counts.reduce((sum, c) => sum + (c - expected) ** 2 / expected, 0);
+  // df = 77，p = 1e-4 的临界值约 132
+  assert.ok(chi2(first) < 132, `first position chi2=${chi2(first).toFixed(1)}`);
+  assert.ok(chi2(last) < 132, `last position chi2=${chi2(last).toFixed(1)}`);
+});
+
+test('drawTarotSpreadCSPRNG returns unique cards and caps at deck size', () => {
+  const cards = tarotTools.drawTarotSpreadCSPRNG(10);
+  assert.strictEqual(cards.length, 10);
+  assert.strictEqual(new Set(cards.map(c => c.id)).size, 10);
+  assert.strictEqual(tarotTools.drawTarotSpreadCSPRNG(100).length, 78);
+});
+
+test('TRNG firmware web_ui_gz.h is in sync with web_ui.h', () => {
+  const webui = require('../scripts/build-trng-webui.js');
+  const fsW = require('fs');
+  const html = webui.extractHTML(fsW.readFileSync(webui.srcFile, 'utf-8'));
+  const generated = fsW.readFileSync(webui.outFile, 'utf-8');
+  assert.ok(generated.includes(`#define WEB_UI_ETAG "\\"${webui.computeETag(html)}\\""`),
+    'web_ui.h 已修改，请运行 npm run build-trng-webui 重新生成 web_ui_gz.h');
+  const zlibW = require('zlib');
+  const bytes = (generated.match(/0x[0-9a-f]{2}/g) || []).map(h => parseInt(h, 16));
+  assert.strictEqual(zlibW.gunzipSync(Buffer.from(bytes)).toString('utf-8'), html);
+});
+
+// TRNG 串口会话：以内存中的假串口模拟固件（开机日志、HELLO 握手、#id 回显、乱序应答）
+async function runTrngSerialSessionTests() {
+  console.log('\nTRNG Serial Session:');
+  const { EventEmitter } = require('events');
+  const { TrngSerialSession } = require('../src/main/trng-serial.js');
+
+  // proto 2 时模拟链路协商：双方波特率不一致或超过桥接芯片上限（bridgeMaxBaud）的数据整段丢失，
+  // BAUD 以原速率应答后切换，confirmMs 内未收到 PING/HELLO 则退回原速率
+  // 固件 draw_cbor.h 的最小编码：CBOR 头 + 单字母键映射
+  const cborHead = (major, v) => v < 24 ? Buffer.from([(major << 5) | v])
+    : v < 0x100 ? Buffer.from([(major << 5) | 24, v])
+      : v < 0x10000 ? Buffer.from([(major << 5) | 25, v >> 8, v & 0xff])
+        : Buffer.concat([Buffer.from([(major << 5) | 26]), Buffer.from(Uint32Array.of(v).buffer).reverse()]);
+  const cborText = (t) => Buffer.concat([cborHead(3, Buffer.byteLength(t)), Buffer.from(t)]);
+  const cborFrame = (id, code) => {
+    const body = Buffer.concat([cborHead(5, 3), cborText('i'), cborHead(0, id), cborText('c'), cborHead(0, code), cborText('e'), cborText('TRNG')]);
+    return Buffer.concat([Buffer.from([0xc0, body.length & 0xff, body.length >> 8]), body]);
+  };
+
+  // deviceBaud 模拟上个会话留下、未复位的设备速率
+  function fakeFirmware({ reorder = false, proto = 1, link = 'uart', bridgeMaxBaud = Infinity, confirmMs = 30, deviceBaud = 115200 } = {}) {
+    const port = new EventEmitter();
+    port.isOpen = false;
+    port.writes = [];
+    port.baudRate = 115200;
+    port.deviceBaud = () => deviceBaud;
+    let revertTimer = null;
+    let cbor = false;
+    const lineOk = (rate) => rate === port.baudRate && rate <= bridgeMaxBaud;
+    let rx = '';
+    let queued = [];
+    port.update = ({ baudRate }, cb) => { port.baudRate = baudRate; setImmediate(() => cb(null)); };
+    port.write = (data, cb) => {
+      port.writes.push(data);
+      if (!lineOk(deviceBaud)) {
+        if (cb) cb(null);
+        return true;
+      }
+      rx += data;
+      let switchTo = 0;
+      let nl;
+      while ((nl = rx.indexOf('\n')) >= 0) {
+        const line = rx.slice(0, nl).trim();
+        rx = rx.slice(nl + 1);
+        const m = line.match(/^#(\d+) (.*)$/);
+        if (!m) continue;
+        const [, id, cmd] = m;
+        let body;
+        if (cmd === 'HELLO' || cmd === 'PING') clearTimeout(revertTimer);
+        if (cmd === 'HELLO') cbor = false;
+        if (cmd === 'DRAW' && cbor) {
+          queued.push({ data: cborFrame(Number(id), (Number(id) % 78) * 2 + Number(id) % 2), rate: deviceBaud });
+          continue;
+        }
+        if (cmd === 'HELLO' && proto >= 2) body = `"hello":true,"proto":${proto},"link":"${link}","baud":${deviceBaud},"maxBaud":3000000`;
+        else if (cmd === 'HELLO') body = `"hello":true,"proto":${proto}`;
+        else if (cmd === 'PING') body = '"pong":true';
+        else if (cmd === 'FMT:CBOR' && proto >= 3) {
+          cbor = true;
+          body = '"format":"cbor"';
+        }
+        else if (cmd.startsWith('BAUD:') && link === 'usb-cdc') body = `"baud":${deviceBaud},"link":"usb-cdc","confirmMs":0`;
+        else if (cmd.startsWith('BAUD:')) {
+          switchTo = Number(cmd.slice(5));
+          body = `"baud":${switchTo},"link":"uart","confirmMs":${confirmMs}`;
+        } else if (cmd === 'DRAW') body = `"cardIndex":${Number(id) % 78},"isReversed":${Number(id) % 2 === 1}`;
+        else body = '"error":"Unknown command"';
+        queued.push({ data: Buffer.from(`{"id":${id},${body}}\n`), rate: deviceBaud });
+      }
+      if (switchTo) {
+        const previous = deviceBaud;
+        deviceBaud = switchTo;
+        rx = '';
+        revertTimer = setTimeout(() => { deviceBaud = previous; rx = ''; }, confirmMs);
+      }
+      // 批量应答：reorder 时倒序返回，验证按 id 分发而非按到达顺序
+      setImmediate(() => {
+        const out = (reorder ? queued.reverse() : queued).filter(r => lineOk(r.rate)).map(r => r.data);
+        queued = [];
+        // 逐字节送达，检验跨数据块拼接 CBOR 帧与 JSON 行
+        if (out.length) for (const b of Buffer.concat(out)) port.emit('data', Buffer.from([b]));
+      });
+      if (cb) cb(null);
+      return true;
+    };
+    port.close = () => { port.isOpen = false; port.emit('close'); };
+    setImmediate(() => {
+      port.emit('data', Buffer.from('ESP-ROM:esp32s3-20210327\r\nrst:0x1 (POWERON)\r\n{"stale":true}\n'));
+      port.isOpen = true;
+      port.emit('open');
+    });
+    return port;
+  }
+
+  await testAsync('serial session handshakes past boot log and pipelines requests', async () => {
+    let port;
+    const session = new TrngSerialSession('FAKE', 115200, { createPort: () => (port = fakeFirmware({ reorder: true })), idleCloseMs: 0 });
+    const replies = await Promise.all(Array.from({ length: 10 }, () => session.request('DRAW')));
+    assert.strictEqual(session.hello.proto, 1);
+    replies.forEach((r, i) => {
+      assert.strictEqual(r.cardIndex, (i + 1) % 78);
+      assert.strictEqual(r.id, undefined);
+    });
+    const cmds = port.writes.filter(w => w.startsWith('#') && !w.includes('HELLO'));
+    assert.deepStrictEqual(cmds, Array.from({ length: 10 }, (_, i) => `#${i + 1} DRAW\n`));
+    session.close();
+  });
+
+  await testAsync('serial session rejects device errors and in-flight requests on close', async () => {
+    const session = new TrngSerialSession('FAKE', 115200, { createPort: () => fakeFirmware(), idleCloseMs: 0 });
+    await assert.rejects(session.request('BOGUS'), /Unknown command/);
+    const inflight = session.request('DRAW');
+    session.close();
+    await assert.rejects(inflight, /已关闭/);
+    await assert.rejects(session.request('DRAW'), /已关闭/);
+  });
+
+  // 每个用例独立的速率记录，互不影响
+  const fastBaud = () => ({ baudSettleMs: 0, baudConfirmTimeoutMs: 20, baudRevertMarginMs: 10, linkCache: new Map() });
+
+  await testAsync('serial session negotiates the fastest baud the bridge sustains', async () => {
+    let port;
+    const session = new TrngSerialSession('FAKE', 115200, {
+      createPort: () => (port = fakeFirmware({ proto: 2, bridgeMaxBaud: 921600 })), idleCloseMs: 0, ...fastBaud()
+    });
+    const reply = await session.request('DRAW');
+    assert.strictEqual(typeof reply.cardIndex, 'number');
+    assert.deepStrictEqual(session.linkInfo(), { link: 'uart', baud: 921600, format: 'json', maxBaud: 3000000, chip: null });
+    assert.strictEqual(port.baudRate, 921600);
+    const bauds = port.writes.filter(w => w.includes('BAUD:')).map(w => Number(w.split(':')[1]));
+    assert.deepStrictEqual(bauds, [3000000, 2000000, 1500000, 921600]);
+    session.close();
+  });
+
+  await testAsync('serial session skips baud negotiation on USB-CDC and proto 1 firmware', async () => {
+    for (const opts of [{ proto: 2, link: 'usb-cdc' }, { proto: 1 }]) {
+      let port;
+      const session = new TrngSerialSession('FAKE', 115200, { createPort: () => (port = fakeFirmware(opts)), idleCloseMs: 0, ...fastBaud() });
+      await session.request('DRAW');
+      assert.ok(!port.writes.some(w => w.includes('BAUD:')));
+      assert.strictEqual(session.linkInfo().baud, 115200);
+      session.close();
+    }
+  });
+
+  await testAsync('serial session switches proto 3 firmware to CBOR frames', async () => {
+    let port;
+    const session = new TrngSerialSession('FAKE', 115200, {
+      createPort: () => (port = fakeFirmware({ proto: 3, reorder: true })), idleCloseMs: 0, negotiate: false
+    });
+    const replies = await Promise.all(Array.from({ length: 6 }, () => session.request('DRAW')));
+    assert.strictEqual(session.linkInfo().format, 'cbor');
+    assert.ok(port.writes.some(w => w.includes('FMT:CBOR')));
+    const firstId = Number(port.writes.find(w => / DRAW\n$/.test(w)).match(/^#(\d+)/)[1]);
+    replies.forEach((r, i) => {
+      const id = firstId + i;
+      assert.deepStrictEqual(r, { cardIndex: id % 78, isReversed: id % 2 === 1, entropySource: 'TRNG' });
+    });
+    session.close();
+
+    const jsonSession = new TrngSerialSession('FAKE', 115200, {
+      createPort: () => fakeFirmware({ proto: 3 }), idleCloseMs: 0, negotiate: false, format: 'json'
+    });
+    assert.strictEqual(typeof (await jsonSession.request('DRAW')).cardIndex, 'number');
+    assert.strictEqual(jsonSession.linkInfo().format, 'json');
+    jsonSession.close();
+  });
+
+  await testAsync('serial session honours maxBaud', async () => {
+    let port;
+    const session = new TrngSerialSession('FAKE', 115200, {
+      createPort: () => (port = fakeFirmware({ proto: 2 })), idleCloseMs: 0, maxBaud: 460800, ...fastBaud()
+    });
+    await session.request('PING');
+    assert.strictEqual(session.linkInfo().baud, 460800);
+    assert.deepStrictEqual(port.writes.filter(w => w.includes('BAUD:')), ['#1 BAUD:460800\n']);
+    session.close();
+  });
+
+  await testAsync('serial session reopens at the cached rate without retrying failed ones', async () => {
+    const opts = { idleCloseMs: 0, ...fastBaud() };
+    let port;
+    const first = new TrngSerialSession('FAKE', 115200, { createPort: () => (port = fakeFirmware({ proto: 2, bridgeMaxBaud: 921600 })), ...opts });
+    await first.request('PING');
+    await first.shutdown();
+    assert.deepStrictEqual(opts.linkCache.get('FAKE'), { good: 921600, failed: new Set([3000000, 2000000, 1500000]) });
+
+    const second = new TrngSerialSession('FAKE', 115200, { createPort: () => (port = fakeFirmware({ proto: 2, bridgeMaxBaud: 921600 })), ...opts });
+    await second.request('PING');
+    assert.strictEqual(second.linkInfo().baud, 921600);
+    assert.deepStrictEqual(port.writes.filter(w => w.includes('BAUD:')), ['#1 BAUD:921600\n']);
+    second.close();
+
+    // 缓存的速率失效（换了桥接芯片）：记为失败，继续向下尝试
+    const third = new TrngSerialSession('FAKE', 115200, { createPort: () => (port = fakeFirmware({ proto: 2, bridgeMaxBaud: 460800 })), ...opts });
+    await third.request('PING');
+    assert.strictEqual(third.linkInfo().baud, 460800);
+    const bauds = port.writes.filter(w => w.includes('BAUD:')).map(w => Number(w.split(':')[1]));
+    assert.deepStrictEqual(bauds, [921600, 460800]);
+    assert.strictEqual(opts.linkCache.get('FAKE').good, 460800);
+    third.close();
+  });
+
+  await testAsync('serial session steps the link back to the power-on rate before closing', async () => {
+    let port;
+    const session = new TrngSerialSession('FAKE', 115200, {
+      createPort: () => (port = fakeFirmware({ proto: 2, bridgeMaxBaud: 921600 })), idleCloseMs: 0, ...fastBaud()
+    });
+    await session.request('PING');
+    assert.strictEqual(port.deviceBaud(), 921600);
+    await session.shutdown();
+    assert.ok(session.closed);
+    assert.strictEqual(port.writes.filter(w => w.includes('BAUD:')).pop(), `#${session.nextId - 2} BAUD:115200\n`);
+    await new Promise(r => setTimeout(r, 60)); // 超过设备确认窗口：已确认，不会弹回 921600
+    assert.strictEqual(port.deviceBaud(), 115200);
+  });
+
+  await testAsync('serial session finds firmware left at a negotiated rate', async () => {
+    let port;
+    const session = new TrngSerialSession('FAKE', 115200, {
+      createPort: () => (port = fakeFirmware({ proto: 2, bridgeMaxBaud: 921600, deviceBaud: 921600 })),
+      idleCloseMs: 0, baudProbeAfterMs: 0, ...fastBaud()
+    });
+    const reply = await session.request('DRAW');
+    assert.strictEqual(typeof reply.cardIndex, 'number');
+    assert.strictEqual(session.linkInfo().baud, 921600);
+    assert.strictEqual(session.hello.baud, 921600);
+    // 找回后只向上尝试更高档位
+    const bauds = port.writes.filter(w => w.includes('BAUD:')).map(w => Number(w.split(':')[1]));
+    assert.deepStrictEqual(bauds, [3000000, 2000000, 1500000]);
+    session.close();
+  });
+}
+
+// CBOR 应答解码：字节序列与固件原生测试（IoT-Firmware/native/core_test.cpp）一致
+console.log('\nTRNG CBOR:');
+test('TRNG CBOR replies decode to the JSON field names', () => {
+  const { decodeTrngReply, decodeCbor } = require('../src/main/trng-cbor.js');
+  const spread = Buffer.from([0xa4, 0x61, 0x69, 0x07, 0x61, 0x73, 0x65, ...Buffer.from('three'),
+    0x61, 0x63, 0x83, 0x00, 0x17, 0x18, 155, 0x61, 0x65, 0x64, ...Buffer.from('TRNG')]);
+  assert.deepStrictEqual(decodeTrngReply(spread), {
+    id: 7, spreadId: 'three', count: 3, entropySource: 'TRNG',
+    cards: [{ cardIndex: 0, isReversed: false }, { cardIndex: 11, isReversed: true }, { cardIndex: 77, isReversed: true }]
+  });
+  const single = Buffer.from([0xa2, 0x61, 0x63, 0x18, 81, 0x61, 0x65, 0x64, ...Buffer.from('TRNG')]);
+  assert.deepStrictEqual(decodeTrngReply(single), { cardIndex: 40, isReversed: true, entropySource: 'TRNG' });
+  const value = Buffer.from([0xa2, 0x61, 0x76, 0x1a, 0xde, 0xad, 0xbe, 0xef, 0x61, 0x65, 0x69, ...Buffer.from('TRNG-DRBG')]);
+  assert.deepStrictEqual(decodeTrngReply(value), { value: 0xdeadbeef, entropySource: 'TRNG-DRBG' });
+  const bytes = decodeTrngReply(Buffer.from([0xa3, 0x61, 0x69, 0x19, 0x01, 0x2c, 0x61, 0x62, 0x43, 1, 2, 3, 0x61, 0x65, 0x64, ...Buffer.from('TRNG')]));
+  assert.strictEqual(bytes.id, 300);
+  assert.deepStrictEqual([...bytes.bytes], [1, 2, 3]);
+  const seeds = decodeTrngReply(Buffer.from([0xa3, 0x61, 0x6e, 0x18, 32, 0x61, 0x64, 0x82, 0x44, 1, 2, 3, 4, 0x44, 5, 6, 7, 8,
+    0x61, 0x65, 0x64, ...Buffer.from('TRNG')]));
+  assert.strictEqual(seeds.bits, 32);
+  assert.deepStrictEqual(seeds.seeds.map(b => b.toString('hex')), ['01020304', '05060708']);
+  assert.deepStrictEqual(decodeCbor(Buffer.from([0x82, 0xf5, 0xf6])), [true, null]);
+  assert.throws(() => decodeTrngReply(spread.subarray(0, 10)), /不完整/);
+  assert.throws(() => decodeTrngReply(Buffer.from([0xa1, 0x61, 0x63, 0x18, 200])), /无效的牌码/);
+});
+
+// 共享熵服务：假设备按调用计数返回字节，检验预取、缓冲区供数与来源标注
+async function runEntropyServiceTests() {
+  console.log('\nEntropy Service:');
+  const { EntropyService } = require('../src/main/entropy-service.js');
+
+  await testAsync('entropy service prefetches TRNG bytes and serves draws from the buffer', async () => {
+    const fetches = [];
+    const svc = new EntropyService({
+      capacity: 2048,
+      lowWater: 512,
+      fetchTrng: async (entropy, count) => { fetches.push(count); return Buffer.alloc(count, fetches.length); }
+    });
+    svc.configure({ source: 'trng', trngMode: 'network' });
+    await svc.refilling;
+    assert.strictEqual(svc.stats().buffered, 2048);
+    const before = fetches.length;
+    const { bytes, source } = await svc.take(16);
+    assert.strictEqual(source, 'TRNG');
+    assert.strictEqual(bytes.length, 16);
+    assert.strictEqual(fetches.length, before, '缓冲区充足时不应访问设备');
+    const { value } = await svc.uniform(156);
+    assert.ok(value >= 0 && value < 156);
+    await svc.take(1600);
+    await svc.refilling;
+    assert.ok(fetches.length > before, '低于低水位后应后台补充');
+  });
+
+  await testAsync('entropy service never mixes CSPRNG into TRNG takes', async () => {
+    const svc = new EntropyService({ fetchTrng: async () => { throw new Error('device offline'); } });
+    svc.configure({ source: 'trng' });
+    await assert.rejects(svc.take(4), /device offline/);
+    svc.configure({ source: 'csprng' });
+    const { bytes, source } = await svc.take(4);
+    assert.strictEqual(source, 'CSPRNG');
+    assert.strictEqual(bytes.length, 4);
+  });
+
+  await testAsync('game seeds come from a prefetched full-width TRNG seed stock', async () => {
+    const seedFetches = [];
+    const svc = new EntropyService({
+      fetchTrng: async (entropy, count) => Buffer.alloc(count, 0xab),
+      fetchSeeds: async (entropy, bits, count) => {
+        seedFetches.push([bits, count]);
+        return Array.from({ length: count }, (_, i) => Buffer.from([0x80, 0, seedFetches.length, i]));
+      }
+    });
+    svc.configure({ source: 'trng', trngMode: 'network' });
+    await svc.seedRefilling;
+    assert.deepStrictEqual(seedFetches, [[32, 16]], '配置后应预取一批种子');
+    for (let i = 0; i < 12; i++) {
+      const { seed, source } = await svc.takeSeed();
+      assert.strictEqual(source, 'TRNG');
+      assert.strictEqual(seed, 0x80000100 + i, '种子应是设备给出的完整 32 位');
+    }
+    assert.strictEqual(seedFetches.length, 1, '库存充足时开局不应访问设备');
+    await svc.takeSeed();
+    await svc.seedRefilling;
+    assert.strictEqual(seedFetches.length, 2, '低于低水位后应后台补货');
+
+    // 旧固件没有 SEED：改从 TRNG 字节缓冲区取 4 字节，不混入 CSPRNG
+    const old = new EntropyService({
+      fetchTrng: async (entropy, count) => Buffer.alloc(count, 0xab),
+      fetchSeeds: async () => { throw Object.assign(new Error('HTTP 404'), { unsupported: true }); }
+    });
+    old.configure({ source: 'trng', trngMode: 'network' });
+    assert.deepStrictEqual(await old.takeSeed(), { seed: 0xabababab, source: 'TRNG' });
+    assert.strictEqual(old.seedUnsupported, true);
+  });
+
+  await testAsync('TRNG spread: one /api/draw?count=N round trip when cold, none once prefetched', async () => {
+    const http = require('http');
+    const tarotTools = require('../src/main/tarot-tools.js');
+    const { entropyService } = require('../src/main/entropy-service.js');
+    const hits = [];
+    const server = http.createServer((req, res) => {
+      const url = new URL(req.url, 'http://x');
+      hits.push(url.pathname);
+      if (url.pathname === '/api/draw') {
+        const count = Number(url.searchParams.get('count'));
+        const cards = Array.from({ length: count }, (_, i) => ({ cardIndex: 77 - i, isReversed: i % 2 === 0 }));
+        if ((req.headers.accept || '').includes('application/cbor')) {
+          // {"c":[codes],"e":"TRNG"}，count ≤ 23 时数组头与牌码（≤ 155）各占 1 ~ 2 字节
+          const codes = cards.flatMap(c => { const v = c.cardIndex * 2 + (c.isReversed ? 1 : 0); return v < 24 ? [v] : [0x18, v]; });
+          res.setHeader('Content-Type', 'application/cbor');
+          res.end(Buffer.from([0xa2, 0x61, 0x63, 0x80 | count, ...codes, 0x61, 0x65, 0x64, ...Buffer.from('TRNG')]));
+          return;
+        }
+        res.end(JSON.stringify({ count, cards, entropySource: 'TRNG' }));
+      } else if (url.pathname === '/api/random') {
+        res.end(require('crypto').randomBytes(Number(url.searchParams.get('bytes'))));
+      } else {
+        res.statusCode = 404; // 旧固件没有 /api/stream：预取退回 /api/random?bytes=N
+        res.end('{"ok":false,"error":"Not found"}');
+      }
+    });
+    await new Promise(r => server.listen(0, '127.0.0.1', r));
+    try {
+      const entropy = { source: 'trng', trngMode: 'network', trngNetworkHost: '127.0.0.1', trngNetworkPort: server.address().port };
+      const cold = await tarotTools.drawTarotSpreadTRNG(10, entropy);
+      assert.deepStrictEqual(cold.map(c => c.id), tarotCards.slice(68).reverse().map(c => c.id));
+      assert.strictEqual(hits.filter(p => p === '/api/draw').length, 1);
+      await entropyService.refilling;
+      const warm = await tarotTools.drawTarotSpreadTRNG(10, entropy);
+      assert.strictEqual(new Set(warm.map(c => c.id)).size, 10);
+      assert.ok(warm.every(c => c.entropySource === 'TRNG'));
+      assert.strictEqual(hits.filter(p => p === '/api/draw').length, 1, '预取后不应再访问 /api/draw');
+      assert.strictEqual(hits.filter(p => p === '/api/stream').length, 1, '404 后不应再尝试推送流');
+      // 抽牌中途熵源被切到 CSPRNG：由该次抽取选出的牌不应再标注 TRNG
+      const uniform = entropyService.uniform;
+      let calls = 0;
+      entropyService.uniform = async function (range) {
+        const r = await uniform.call(this, range);
+        return ++calls === 3 ? { ...r, source: 'CSPRNG' } : r;
+      };
+      try {
+        const mixed = await tarotTools.drawTarotSpreadTRNG(10, entropy);
+        assert.deepStrictEqual(mixed.map(c => c.entropySource), mixed.map((_, i) => i === 2 ? 'CSPRNG' : 'TRNG'));
+      } finally {
+        delete entropyService.uniform;
+      }
+    } finally {
+      entropyService.configure({ source: 'csprng' });
+      entropyService.shutdown();
+      server.close();
+    }
+  });
+
+  await testAsync('entropy service prefetches over one /api/stream connection with backpressure', async () => {
+    const http = require('http');
+    const { EntropyService } = require('../src/main/entropy-service.js');
+    const hits = [];
+    let sent = 0;
+    let streamRes = null;
+    const server = http.createServer((req, res) => {
+      const url = new URL(req.url, 'http://x');
+      hits.push(url.pathname);
+      if (url.pathname !== '/api/stream') { res.statusCode = 404; return res.end(); }
+      const bytes = Number(url.searchParams.get('bytes'));
+      res.writeHead(200, { 'Content-Type': 'text/event-stream' });
+      streamRes = res;
+      // 按 TCP 背压推送：写缓冲区满时等待 drain，模拟固件仅在发送缓冲区有空间时生成事件
+      const pump = () => {
+        while (!res.destroyed) {
+          sent++;
+          const block = require('crypto').randomBytes(bytes).toString('hex');
+          if (!res.write(`id: ${sent}\nevent: random\ndata: ${block}\n\n`)) return res.once('drain', pump);
+        }
+      };
+      pump();
+    });
+    await new Promise(r => server.listen(0, '127.0.0.1', r));
+    const svc = new EntropyService({ capacity: 2048, lowWater: 512 });
+    try {
+      svc.configure({ source: 'trng', trngMode: 'network', trngNetworkHost: '127.0.0.1', trngNetworkPort: server.address().port });
+      await svc.refilling;
+      assert.strictEqual(svc.stats().buffered, 2048);
+      assert.strictEqual(svc.stats().transport, 'stream');
+      for (let i = 0; i < 8; i++) {
+        const { bytes, source } = await svc.take(256);
+        assert.strictEqual(bytes.length, 256);
+        assert.strictEqual(source, 'TRNG');
+        await svc.refilling;
+      }
+      assert.deepStrictEqual(hits, ['/api/stream'], '所有预取都应复用同一条推送流');
+      await new Promise(r => setTimeout(r, 100));
+      const before = sent;
+      await new Promise(r => setTimeout(r, 100));
+      assert.strictEqual(sent, before, '本地队列满后设备侧应因背压停止生成');
+    } finally {
+      svc.shutdown();
+      if (streamRes) streamRes.destroy();
+      server.close();
+    }
+  });
+}
+
 // ---- Test Context Manager (simulated - it runs in browser) ----
 console.log('\nContext Manager (logic tests):');
 
@@ -4766,6 +5274,8 @@ test('agent.js 标题生成：走 title-utils 且 LLM 失败时用启发式兜
   await runMcpSpecTests();
   await runPlaywrightDataModeTests();
   await runDsPluginTests();
+  await runTrngSerialSessionTests();
+  await runEntropyServiceTests();
 
   console.log(`\n${'='.repeat(40)}`);
   console.log(`Results: ${passed} passed, ${failed} failed, ${passed + failed} total`);